@@ -0,0 +1,203 @@
+#include "IRGenerator.h"
+
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/Function.h>
+#include <llvm/IR/GlobalVariable.h>
+#include <llvm/IR/IRBuilder.h>
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief createNestedStruct Creates struct.s0 ... struct.s<depth> where every struct contains the previous one
+ * and a global variable of the outermost struct with a non-zero initializer.
+ * @return Global variable of the outermost struct
+ */
+static llvm::GlobalVariable* createNestedStruct(llvm::Module& mod, unsigned depth) {
+    auto& context = mod.getContext();
+    auto* i32 = llvm::Type::getInt32Ty(context);
+    auto* i64 = llvm::Type::getInt64Ty(context);
+
+    auto* strct = llvm::StructType::create(context, { i32, i64 }, "struct.s0");
+    llvm::Constant* init = llvm::ConstantStruct::get(strct, { llvm::ConstantInt::get(i32, 1), llvm::ConstantInt::get(i64, 2) });
+
+    for (unsigned i = 1; i <= depth; i++) {
+        auto* name = llvm::ConstantDataArray::getString(context, "s" + std::to_string(i % 100));
+        auto* outer = llvm::StructType::create(context, { i32, strct, name->getType() }, "struct.s" + std::to_string(i));
+        init = llvm::ConstantStruct::get(outer, { llvm::ConstantInt::get(i32, i), init, name });
+        strct = outer;
+    }
+
+    return new llvm::GlobalVariable(mod, strct, false, llvm::GlobalValue::ExternalLinkage, init, "nested");
+}
+
+/**
+ * @brief createDeepAccess Creates function deep, which loads the innermost field of @nested.
+ */
+static llvm::Function* createDeepAccess(llvm::Module& mod, llvm::GlobalVariable* nested, unsigned depth) {
+    auto& context = mod.getContext();
+    llvm::IRBuilder<> builder(context);
+
+    auto* func = llvm::Function::Create(llvm::FunctionType::get(builder.getInt32Ty(), false), llvm::GlobalValue::ExternalLinkage, "deep", &mod);
+    builder.SetInsertPoint(llvm::BasicBlock::Create(context, "entry", func));
+
+    llvm::Value* ptr = nested;
+    llvm::Type* type = nested->getValueType();
+    for (unsigned i = 0; i < depth; i++) {
+        ptr = builder.CreateStructGEP(type, ptr, 1);
+        type = llvm::cast<llvm::StructType>(type)->getElementType(1);
+    }
+    ptr = builder.CreateStructGEP(type, ptr, 0);
+
+    builder.CreateRet(builder.CreateLoad(builder.getInt32Ty(), ptr));
+    return func;
+}
+
+/**
+ * @brief createDispatch Creates function dispatch containing a switch with @cases cases.
+ */
+static llvm::Function* createDispatch(llvm::Module& mod, unsigned cases) {
+    auto& context = mod.getContext();
+    llvm::IRBuilder<> builder(context);
+    auto* i32 = builder.getInt32Ty();
+
+    auto* func = llvm::Function::Create(llvm::FunctionType::get(i32, { i32 }, false), llvm::GlobalValue::ExternalLinkage, "dispatch", &mod);
+    auto* entry = llvm::BasicBlock::Create(context, "entry", func);
+    auto* defaultBlock = llvm::BasicBlock::Create(context, "default", func);
+    auto* exit = llvm::BasicBlock::Create(context, "exit", func);
+
+    builder.SetInsertPoint(entry);
+    auto* result = builder.CreateAlloca(i32, nullptr, "result");
+    auto* sw = builder.CreateSwitch(func->getArg(0), defaultBlock, cases);
+
+    for (unsigned i = 0; i < cases; i++) {
+        auto* block = llvm::BasicBlock::Create(context, "case" + std::to_string(i), func, defaultBlock);
+        sw->addCase(builder.getInt32(i * 3), block);
+        builder.SetInsertPoint(block);
+        builder.CreateStore(builder.getInt32(i * 7 + 1), result);
+        builder.CreateBr(exit);
+    }
+
+    builder.SetInsertPoint(defaultBlock);
+    builder.CreateStore(builder.getInt32(0), result);
+    builder.CreateBr(exit);
+
+    builder.SetInsertPoint(exit);
+    builder.CreateRet(builder.CreateLoad(i32, result));
+    return func;
+}
+
+/**
+ * @brief fillFunction Creates body of function @func with @blocks blocks in a chain.
+ * Every block updates the local variable x using a scalar global picked by @index and an element of @table,
+ * the last block jumps back to the first one.
+ */
+static void fillFunction(llvm::Function* func, unsigned index, llvm::Function* callee, unsigned blocks, const std::vector<llvm::GlobalVariable*>& globals, llvm::GlobalVariable* table) {
+    auto& context = func->getContext();
+    llvm::IRBuilder<> builder(context);
+    auto* i32 = builder.getInt32Ty();
+
+    auto* entry = llvm::BasicBlock::Create(context, "entry", func);
+    std::vector<llvm::BasicBlock*> chain;
+    for (unsigned i = 0; i < blocks; i++) {
+        chain.push_back(llvm::BasicBlock::Create(context, "bb" + std::to_string(i), func));
+    }
+    auto* exit = llvm::BasicBlock::Create(context, "exit", func);
+
+    builder.SetInsertPoint(entry);
+    auto* x = builder.CreateAlloca(i32, nullptr, "x");
+    auto* arg = func->getArg(0);
+    builder.CreateStore(arg, x);
+    if (callee) {
+        builder.CreateStore(builder.CreateCall(callee, { arg }), x);
+    }
+    builder.CreateBr(chain.empty() ? exit : chain.front());
+
+    unsigned tableSize = table ? llvm::cast<llvm::ArrayType>(table->getValueType())->getNumElements() : 0;
+
+    for (unsigned i = 0; i < blocks; i++) {
+        builder.SetInsertPoint(chain[i]);
+        llvm::Value* value = builder.CreateLoad(i32, x);
+
+        if (!globals.empty()) {
+            auto* global = globals[(index + i * 31) % globals.size()];
+            value = builder.CreateAdd(value, builder.CreateLoad(i32, global));
+        }
+
+        if (tableSize) {
+            auto* elem = builder.CreateInBoundsGEP(table->getValueType(), table, { builder.getInt64(0), builder.getInt64((i * 127) % tableSize) });
+            value = builder.CreateXor(value, builder.CreateLoad(i32, elem));
+        }
+
+        value = builder.CreateMul(value, builder.getInt32(3));
+        builder.CreateStore(value, x);
+
+        auto* cond = builder.CreateICmpSLT(value, builder.getInt32(i));
+        auto* next = i + 1 < blocks ? chain[i + 1] : chain.front();
+        builder.CreateCondBr(cond, next, exit);
+    }
+
+    builder.SetInsertPoint(exit);
+    builder.CreateRet(builder.CreateLoad(i32, x));
+}
+
+std::unique_ptr<llvm::Module> generateModule(llvm::LLVMContext& context, const GeneratorOptions& options) {
+    auto mod = std::make_unique<llvm::Module>("bench", context);
+    llvm::IRBuilder<> builder(context);
+    auto* i32 = builder.getInt32Ty();
+
+    auto* nested = createNestedStruct(*mod, options.structDepth);
+
+    std::vector<llvm::GlobalVariable*> globals;
+    for (unsigned i = 0; i < options.globals; i++) {
+        globals.push_back(new llvm::GlobalVariable(*mod, i32, false, llvm::GlobalValue::ExternalLinkage, builder.getInt32(i), "g" + std::to_string(i)));
+    }
+
+    llvm::GlobalVariable* table = nullptr;
+    if (options.initializerSize) {
+        // dense table of integers, sparse table of integers and a long string
+        std::vector<uint32_t> dense(options.initializerSize);
+        std::vector<uint32_t> sparse(options.initializerSize);
+        std::string text(options.initializerSize, 'a');
+        for (unsigned i = 0; i < options.initializerSize; i++) {
+            dense[i] = i * 2654435761u;
+            sparse[i] = i % 64 == 0 ? i : 0;
+            text[i] = "llvm2c\n\t\"?\\"[i % 12];
+        }
+
+        table = new llvm::GlobalVariable(*mod, llvm::ArrayType::get(i32, dense.size()), true, llvm::GlobalValue::InternalLinkage, llvm::ConstantDataArray::get(context, dense), "table");
+        new llvm::GlobalVariable(*mod, llvm::ArrayType::get(i32, sparse.size()), false, llvm::GlobalValue::ExternalLinkage, llvm::ConstantDataArray::get(context, sparse), "sparse");
+        auto* str = llvm::ConstantDataArray::getString(context, text);
+        new llvm::GlobalVariable(*mod, str->getType(), true, llvm::GlobalValue::InternalLinkage, str, "text");
+    }
+
+    if (!globals.empty()) {
+        // array of pointers to the scalar globals
+        std::vector<llvm::Constant*> pointers(globals.begin(), globals.end());
+        auto* type = llvm::ArrayType::get(globals.front()->getType(), pointers.size());
+        new llvm::GlobalVariable(*mod, type, false, llvm::GlobalValue::ExternalLinkage, llvm::ConstantArray::get(type, pointers), "pointers");
+    }
+
+    auto* funcType = llvm::FunctionType::get(i32, { i32 }, false);
+    std::vector<llvm::Function*> functions;
+    for (unsigned i = 0; i < options.functions; i++) {
+        functions.push_back(llvm::Function::Create(funcType, llvm::GlobalValue::ExternalLinkage, "f" + std::to_string(i), mod.get()));
+    }
+    for (unsigned i = 0; i < options.functions; i++) {
+        fillFunction(functions[i], i, i ? functions[i - 1] : nullptr, options.blocks, globals, table);
+    }
+
+    auto* deep = createDeepAccess(*mod, nested, options.structDepth);
+    auto* dispatch = createDispatch(*mod, options.switchCases);
+
+    auto* main = llvm::Function::Create(llvm::FunctionType::get(i32, false), llvm::GlobalValue::ExternalLinkage, "main", mod.get());
+    builder.SetInsertPoint(llvm::BasicBlock::Create(context, "entry", main));
+    llvm::Value* result = builder.CreateAdd(builder.CreateCall(deep), builder.CreateCall(dispatch, { builder.getInt32(3) }));
+    if (!functions.empty()) {
+        result = builder.CreateAdd(result, builder.CreateCall(functions.back(), { builder.getInt32(1) }));
+    }
+    builder.CreateRet(result);
+
+    return mod;
+}
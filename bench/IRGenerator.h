@@ -0,0 +1,27 @@
+#pragma once
+
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+
+#include <memory>
+
+/**
+ * @brief Shape of a synthetic module created by generateModule.
+ */
+struct GeneratorOptions {
+    unsigned functions = 100; // number of generated functions f0, ..., fN-1
+    unsigned blocks = 20; // number of basic blocks in every generated function
+    unsigned globals = 100; // number of scalar global variables
+    unsigned structDepth = 16; // nesting depth of the generated struct types
+    unsigned initializerSize = 10000; // number of elements of the big global array initializers
+    unsigned switchCases = 256; // number of cases of the switch in function dispatch
+};
+
+/**
+ * @brief generateModule Creates a module in the shape produced by clang -O0,
+ * so that it exercises the same code paths of llvm2c as real inputs do.
+ * @param context LLVM context owning the module
+ * @param options Size of the generated module
+ * @return Generated module
+ */
+std::unique_ptr<llvm::Module> generateModule(llvm::LLVMContext& context, const GeneratorOptions& options);
@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+
+"""
+Measures how long a C compiler takes to compile the output of llvm2c.
+Every input is translated by llvm2c and the result is compiled at every
+optimization level, the fastest of the repeated compilations is reported
+together with the shape of the output (size, labels, gotos, parentheses).
+Inputs can be C files (translated to LLVM the same way as in test/run) or LLVM files.
+"""
+
+import argparse, glob, json, os, re, shutil, tempfile, time
+from subprocess import run, DEVNULL, PIPE
+
+root = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+
+parser = argparse.ArgumentParser(description=__doc__)
+parser.add_argument('inputs', nargs='*', help='C or LLVM files (default: test/inputs and test/perf)')
+parser.add_argument('--llvm2c', default='./llvm2c', help='path to llvm2c')
+parser.add_argument('--bench', help='path to llvm2c-bench, adds a generated module to the inputs')
+parser.add_argument('--cc', default='clang', help='compiler of the translated files')
+parser.add_argument('--levels', default='-O0,-O2', help='comma separated optimization levels')
+parser.add_argument('-r', '--repeat', type=int, default=3, help='number of compilations, the fastest one is used')
+parser.add_argument('--json', help='writes the results as JSON to the given file')
+args = parser.parse_args()
+
+
+def to_llvm(source, tempdir):
+    if source.endswith('.ll') or source.endswith('.bc'):
+        return source
+    ll = os.path.join(tempdir, 'input.ll')
+    proc = run(['clang', source, '-g', '-emit-llvm', '-S', '-Xclang', '-disable-O0-optnone', '-o', ll], stdout=DEVNULL, stderr=DEVNULL)
+    if proc.returncode != 0:
+        raise RuntimeError('clang could not translate the input to LLVM')
+    return ll
+
+
+def shape(path):
+    with open(path, errors='replace') as f:
+        text = f.read()
+    return {
+        'bytes': len(text),
+        'lines': text.count('\n'),
+        'labels': len(re.findall(r'^\s*\w+:\s*$', text, re.MULTILINE)),
+        'gotos': len(re.findall(r'\bgoto\b', text)),
+        'parens': text.count('('),
+    }
+
+
+def compile_time(path, level):
+    best = None
+    for _ in range(args.repeat):
+        start = time.perf_counter()
+        proc = run([args.cc, level, '-w', '-c', path, '-o', os.devnull], stdout=DEVNULL, stderr=PIPE, universal_newlines=True)
+        elapsed = time.perf_counter() - start
+        if proc.returncode != 0:
+            raise RuntimeError('%s %s could not compile the output:\n%s' % (args.cc, level, proc.stderr[:500]))
+        best = elapsed if best is None else min(best, elapsed)
+    return best
+
+
+def measure(source, tempdir, levels):
+    output = os.path.join(tempdir, 'output.c')
+    ll = to_llvm(source, tempdir)
+    if run([args.llvm2c, ll, '-o', output], stdout=DEVNULL, stderr=DEVNULL).returncode != 0:
+        raise RuntimeError('llvm2c failed to translate the input')
+
+    result = shape(output)
+    for level in levels:
+        result[level] = compile_time(output, level)
+    return result
+
+
+def main():
+    levels = args.levels.split(',')
+    inputs = args.inputs or sorted(glob.glob(os.path.join(root, 'test', 'inputs', '*', '*.c')) + glob.glob(os.path.join(root, 'test', 'perf', '*.c')))
+    tempdir = tempfile.mkdtemp()
+
+    if args.bench:
+        generated = os.path.join(tempdir, 'generated.ll')
+        if run([args.bench, '-emit-ll=' + generated]).returncode != 0:
+            print('llvm2c-bench could not generate a module')
+            return 1
+        inputs.append(generated)
+
+    results = {}
+    failed = 0
+    print('%-40s %10s %8s %8s' % ('input', 'bytes', 'labels', 'gotos') + ''.join(' %10s' % (l + ' [s]') for l in levels))
+    try:
+        for source in inputs:
+            name = os.path.relpath(source, root) if source.startswith(root) else os.path.basename(source)
+            try:
+                result = measure(source, tempdir, levels)
+            except RuntimeError as e:
+                print('%-40s [NOK] %s' % (name, e))
+                failed += 1
+                continue
+            results[name] = result
+            print('%-40s %10d %8d %8d' % (name, result['bytes'], result['labels'], result['gotos']) + ''.join(' %10.3f' % result[l] for l in levels))
+    finally:
+        shutil.rmtree(tempdir)
+
+    for level in levels:
+        print('total %s: %.3fs' % (level, sum(r[level] for r in results.values())))
+
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump({'cc': args.cc, 'results': results}, f, indent=2)
+
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    exit(main())
@@ -0,0 +1,141 @@
+#include "IRGenerator.h"
+
+#include "../core/Program.h"
+#include "../parser/ProgramParser.h"
+#include "../writer/Writer.h"
+
+#include "llvm/IRReader/IRReader.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/SourceMgr.h"
+#include "llvm/Support/raw_ostream.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace llvm;
+
+/**
+ * @brief Minimum and total time of one measured phase over all repetitions.
+ */
+struct Timing {
+    double min = 0;
+    double total = 0;
+    unsigned runs = 0;
+
+    void add(double seconds) {
+        min = runs == 0 ? seconds : std::min(min, seconds);
+        total += seconds;
+        runs++;
+    }
+};
+
+int main(int argc, char** argv) {
+    cl::OptionCategory options("llvm2c-bench options");
+    cl::opt<std::string> Input(cl::Positional, cl::desc("[input]"), cl::cat(options));
+    cl::opt<unsigned> Repeat("repeat", cl::desc("Number of measured translations"), cl::init(5), cl::cat(options));
+    cl::opt<unsigned> Functions("functions", cl::desc("Number of generated functions"), cl::init(GeneratorOptions().functions), cl::cat(options));
+    cl::opt<unsigned> Blocks("blocks", cl::desc("Number of basic blocks per generated function"), cl::init(GeneratorOptions().blocks), cl::cat(options));
+    cl::opt<unsigned> Globals("globals", cl::desc("Number of generated scalar globals"), cl::init(GeneratorOptions().globals), cl::cat(options));
+    cl::opt<unsigned> StructDepth("struct-depth", cl::desc("Nesting depth of generated structs"), cl::init(GeneratorOptions().structDepth), cl::cat(options));
+    cl::opt<unsigned> InitializerSize("initializer-size", cl::desc("Number of elements of generated array initializers"), cl::init(GeneratorOptions().initializerSize), cl::cat(options));
+    cl::opt<unsigned> SwitchCases("switch-cases", cl::desc("Number of cases of the generated switch"), cl::init(GeneratorOptions().switchCases), cl::cat(options));
+    cl::opt<bool> Structured("structured", cl::desc("Measures translation with control-flow structuring"), cl::cat(options));
+    cl::opt<std::string> EmitLL("emit-ll", cl::desc("Writes the generated module to <filename> instead of measuring"), cl::value_desc("filename"), cl::cat(options));
+
+    cl::HideUnrelatedOptions(options);
+    cl::ParseCommandLineOptions(argc, argv, "Measures time spent in every pass of llvm2c and in the writer.\n"
+                                            "Translates <input> if given, otherwise a generated module.\n");
+
+    LLVMContext context;
+    std::unique_ptr<Module> module;
+
+    if (Input.empty()) {
+        GeneratorOptions generator;
+        generator.functions = Functions;
+        generator.blocks = Blocks;
+        generator.globals = Globals;
+        generator.structDepth = StructDepth;
+        generator.initializerSize = InitializerSize;
+        generator.switchCases = SwitchCases;
+        module = generateModule(context, generator);
+
+        if (!EmitLL.empty()) {
+            std::error_code error;
+            raw_fd_ostream file(EmitLL, error, sys::fs::OF_None);
+            if (error) {
+                std::cerr << "Output file cannot be opened!\n";
+                return 1;
+            }
+            module->print(file, nullptr);
+            return 0;
+        }
+    } else {
+        SMDiagnostic error;
+        module = parseIRFile(Input, error, context);
+        if (!module) {
+            std::cerr << "Error loading module - invalid input file:\n" << Input << "\n";
+            return 1;
+        }
+    }
+
+    size_t instructions = 0;
+    for (const auto& func : *module) {
+        instructions += func.getInstructionCount();
+    }
+
+    // passes are kept in the order in which they ran
+    std::vector<std::string> order;
+    std::map<std::string, Timing> timings;
+    size_t outputSize = 0;
+
+    try {
+        for (unsigned i = 0; i < std::max(1u, (unsigned)Repeat); i++) {
+            ProgramParser parser(false, Structured);
+            auto program = parser.parse(module.get());
+
+            for (const auto& pass : parser.getPassTimes()) {
+                if (!timings.count(pass.first)) {
+                    order.push_back(pass.first);
+                }
+                timings[pass.first].add(pass.second);
+            }
+
+            std::ostringstream out;
+            auto writeStart = std::chrono::steady_clock::now();
+            Writer wr{ out, false, false, false };
+            wr.writeProgram(program);
+            std::chrono::duration<double> writeTime = std::chrono::steady_clock::now() - writeStart;
+
+            if (!timings.count("Writer")) {
+                order.push_back("Writer");
+            }
+            timings["Writer"].add(writeTime.count());
+            outputSize = out.str().size();
+        }
+    } catch (std::invalid_argument& e) {
+        std::cerr << e.what();
+        return 1;
+    }
+
+    printf("instructions: %zu, output: %zu bytes, runs: %u\n\n", instructions, outputSize, timings["Writer"].runs);
+    printf("%-28s %12s %12s\n", "phase", "min [ms]", "avg [ms]");
+
+    double totalMin = 0;
+    double totalAvg = 0;
+    for (const auto& name : order) {
+        const auto& timing = timings[name];
+        printf("%-28s %12.3f %12.3f\n", name.c_str(), timing.min * 1000, timing.total / timing.runs * 1000);
+        totalMin += timing.min;
+        totalAvg += timing.total / timing.runs;
+    }
+    printf("%-28s %12.3f %12.3f\n", "total", totalMin * 1000, totalAvg * 1000);
+
+    return 0;
+}
@@ -0,0 +1,255 @@
+#include "IRGenerator.h"
+
+#include "../core/Program.h"
+#include "../parser/ProgramParser.h"
+#include "../writer/Writer.h"
+
+#include "llvm/IRReader/IRReader.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/SourceMgr.h"
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+using namespace llvm;
+
+/**
+ * @brief Stream buffer that only counts the written bytes, so that the size of the output does not affect memory usage.
+ */
+class CountingBuffer : public std::streambuf {
+public:
+    size_t count = 0;
+
+protected:
+    int overflow(int c) override {
+        count++;
+        return c;
+    }
+
+    std::streamsize xsputn(const char*, std::streamsize n) override {
+        count += n;
+        return n;
+    }
+};
+
+/**
+ * @brief Result of translating one input, passed from the child process to the parent.
+ */
+struct Measurement {
+    size_t instructions = 0;
+    size_t outputBytes = 0;
+    double seconds = 0;
+    bool ok = false;
+};
+
+struct Point {
+    std::string input;
+    Measurement measurement;
+    long peakRssKiB;
+};
+
+static size_t countInstructions(const Module& module) {
+    size_t result = 0;
+    for (const auto& func : module) {
+        result += func.getInstructionCount();
+    }
+    return result;
+}
+
+/**
+ * @brief translate Translates @module with output discarded and adds the time and sizes to @result.
+ */
+static void translate(const Module* module, Measurement& result) {
+    CountingBuffer buffer;
+    std::ostream out(&buffer);
+
+    auto start = std::chrono::steady_clock::now();
+    ProgramParser parser(false);
+    auto program = parser.parse(module);
+    Writer wr{ out, false, false, false };
+    wr.writeProgram(program);
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+
+    result.instructions += countInstructions(*module);
+    result.outputBytes += buffer.count;
+    result.seconds += time.count();
+}
+
+/**
+ * @brief generatorFor Returns options of a generated module with approximately @instructions instructions.
+ * Globals and initializers grow together with the code.
+ */
+static GeneratorOptions generatorFor(size_t instructions, size_t instructionsPerFunction) {
+    GeneratorOptions options;
+    options.functions = std::max<size_t>(1, instructions / instructionsPerFunction);
+    options.globals = std::max<size_t>(1, instructions / 100);
+    options.initializerSize = std::max<size_t>(1, instructions / 10);
+    return options;
+}
+
+/**
+ * @brief measure Runs @work in a child process, so that the peak RSS of every point is measured separately
+ * and a crash or running out of memory ends only the affected point.
+ */
+template<typename Work>
+static Point measure(const std::string& input, Work work) {
+    Point point{ input, Measurement(), 0 };
+
+    int fds[2];
+    if (pipe(fds) != 0) {
+        throw std::invalid_argument("Cannot create pipe!");
+    }
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        throw std::invalid_argument("Cannot fork!");
+    }
+
+    if (pid == 0) {
+        close(fds[0]);
+        Measurement result;
+        try {
+            work(result);
+            result.ok = true;
+        } catch (std::invalid_argument& e) {
+            std::cerr << e.what();
+        }
+        ssize_t written = write(fds[1], &result, sizeof(result));
+        _exit(written == sizeof(result) ? 0 : 1);
+    }
+
+    close(fds[1]);
+    if (read(fds[0], &point.measurement, sizeof(point.measurement)) != sizeof(point.measurement)) {
+        point.measurement.ok = false;
+    }
+    close(fds[0]);
+
+    int status;
+    struct rusage usage;
+    wait4(pid, &status, 0, &usage);
+    point.peakRssKiB = usage.ru_maxrss;
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        point.measurement.ok = false;
+    }
+
+    return point;
+}
+
+static void writeJson(std::ostream& out, const std::vector<Point>& points) {
+    out << "{\n  \"points\": [";
+    for (size_t i = 0; i < points.size(); i++) {
+        const auto& p = points[i];
+        const auto& m = p.measurement;
+        out << (i ? "," : "") << "\n    {";
+        out << "\"input\": \"" << p.input << "\", ";
+        out << "\"ok\": " << (m.ok ? "true" : "false") << ", ";
+        out << "\"instructions\": " << m.instructions << ", ";
+        out << "\"outputBytes\": " << m.outputBytes << ", ";
+        out << "\"seconds\": " << m.seconds << ", ";
+        out << "\"instructionsPerSecond\": " << (m.seconds > 0 ? m.instructions / m.seconds : 0) << ", ";
+        out << "\"bytesPerSecond\": " << (m.seconds > 0 ? m.outputBytes / m.seconds : 0) << ", ";
+        out << "\"peakRssKiB\": " << p.peakRssKiB << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+int main(int argc, char** argv) {
+    cl::OptionCategory options("llvm2c-scaling options");
+    cl::list<std::string> Corpus(cl::Positional, cl::desc("[corpus files]"), cl::cat(options));
+    cl::opt<unsigned> MinInstructions("min-instructions", cl::desc("Size of the smallest generated input"), cl::init(1000), cl::cat(options));
+    cl::opt<unsigned> MaxInstructions("max-instructions", cl::desc("Size of the largest generated input"), cl::init(10000000), cl::cat(options));
+    cl::opt<unsigned> Factor("factor", cl::desc("Ratio of sizes of consecutive generated inputs"), cl::init(10), cl::cat(options));
+    cl::opt<std::string> Json("json", cl::desc("Writes the measured curve as JSON to <filename>"), cl::value_desc("filename"), cl::cat(options));
+
+    cl::HideUnrelatedOptions(options);
+    cl::ParseCommandLineOptions(argc, argv, "Measures throughput and peak memory of llvm2c on growing generated inputs.\n"
+                                            "The corpus files, if given, are translated one by one and measured as a single point.\n");
+
+    if (Factor < 2) {
+        std::cerr << "Factor must be at least 2!\n";
+        return 1;
+    }
+
+    std::vector<Point> points;
+
+    try {
+        // the difference excludes instructions of the functions that do not grow with the input
+        size_t instructionsPerFunction;
+        {
+            LLVMContext context;
+            GeneratorOptions one;
+            one.functions = 1;
+            GeneratorOptions two;
+            two.functions = 2;
+            instructionsPerFunction = countInstructions(*generateModule(context, two)) - countInstructions(*generateModule(context, one));
+        }
+
+        for (size_t size = MinInstructions; size <= MaxInstructions; size *= Factor) {
+            auto generator = generatorFor(size, instructionsPerFunction);
+            points.push_back(measure("generated-" + std::to_string(size), [&](Measurement& result) {
+                LLVMContext context;
+                auto module = generateModule(context, generator);
+                translate(module.get(), result);
+            }));
+
+            if (!points.back().measurement.ok) {
+                std::cerr << "Translation of " << points.back().input << " failed, larger inputs are skipped\n";
+                break;
+            }
+        }
+
+        if (!Corpus.empty()) {
+            points.push_back(measure("corpus", [&](Measurement& result) {
+                for (const auto& file : Corpus) {
+                    LLVMContext context;
+                    SMDiagnostic error;
+                    auto module = parseIRFile(file, error, context);
+                    if (!module) {
+                        throw std::invalid_argument("Error loading module - invalid input file:\n" + file + "\n");
+                    }
+                    translate(module.get(), result);
+                }
+            }));
+        }
+    } catch (std::invalid_argument& e) {
+        std::cerr << e.what();
+        return 1;
+    }
+
+    printf("%-20s %12s %12s %14s %14s %12s\n", "input", "instrs", "time [s]", "instrs/s", "C bytes/s", "RSS [MiB]");
+    for (const auto& p : points) {
+        const auto& m = p.measurement;
+        if (!m.ok) {
+            printf("%-20s %12s\n", p.input.c_str(), "failed");
+            continue;
+        }
+        printf("%-20s %12zu %12.3f %14.0f %14.0f %12.1f\n", p.input.c_str(), m.instructions, m.seconds,
+               m.seconds > 0 ? m.instructions / m.seconds : 0, m.seconds > 0 ? m.outputBytes / m.seconds : 0, p.peakRssKiB / 1024.0);
+    }
+
+    if (!Json.empty()) {
+        std::ofstream file(Json);
+        if (!file.is_open()) {
+            std::cerr << "Output file cannot be opened!\n";
+            return 1;
+        }
+        writeJson(file, points);
+    }
+
+    for (const auto& p : points) {
+        if (!p.measurement.ok) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -79,6 +79,7 @@ Expr* Func::createPhiVariable(const llvm::Value* phi) {
     auto var = std::make_unique<Value>(getVarName() + "_phi", getType(phi->getType()));
     auto* stackAlloc = program->makeExpr<StackAlloc>(var.get());
     entry->addExpr(stackAlloc);
+    program->stats.phiVariables++;
 
     return program->addOwnership(std::move(var));
 }
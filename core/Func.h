@@ -36,6 +36,9 @@ public:
 
     std::vector<Value*> parameters;
 
+    //parameters declared restrict, created from noalias pointer arguments
+    std::set<const Value*> restrictParameters;
+
     //set containing metadata names of variables (and names of global variables) that are in "var[0-9]+" format, used in creating variable names
     std::set<std::string> metadataVarNames;
 
@@ -0,0 +1,61 @@
+#include "FunctionCost.h"
+
+#include "Program.h"
+
+#include <llvm/IR/Function.h>
+#include <llvm/IR/Instructions.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+FunctionScope::FunctionScope(Program& program, const llvm::Function& func)
+    : program(program),
+      func(func),
+      trace("Function", func.getName()),
+      start(std::chrono::steady_clock::now()),
+      startExprs(Expr::getCreatedCount()) {}
+
+FunctionScope::~FunctionScope() {
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+    auto& cost = program.functionCosts[&func];
+
+    if (!cost.initialized) {
+        cost.initialized = true;
+        cost.name = func.getName().str();
+        cost.instructions = func.getInstructionCount();
+        cost.blocks = func.size();
+        for (const auto& block : func) {
+            cost.phis += std::distance(block.phis().begin(), block.phis().end());
+        }
+    }
+
+    cost.seconds += time.count();
+    cost.exprs += Expr::getCreatedCount() - startExprs;
+}
+
+void printFunctionCosts(std::ostream& out, const Program& program, unsigned top) {
+    std::vector<const FunctionCost*> costs;
+    double total = 0;
+    for (const auto& entry : program.functionCosts) {
+        costs.push_back(&entry.second);
+        total += entry.second.seconds;
+    }
+
+    std::sort(costs.begin(), costs.end(), [](const FunctionCost* a, const FunctionCost* b) {
+        return a->seconds > b->seconds;
+    });
+
+    char line[256];
+    snprintf(line, sizeof(line), "=== cost of functions in passes: %.3f ms in %zu functions ===\n", total * 1000, costs.size());
+    out << line;
+    snprintf(line, sizeof(line), "%-40s %10s %7s %10s %12s %8s %8s\n", "function", "time [ms]", "share", "exprs", "instructions", "blocks", "phis");
+    out << line;
+
+    for (size_t i = 0; i < costs.size() && i < top; i++) {
+        const auto* cost = costs[i];
+        snprintf(line, sizeof(line), "%-40s %10.3f %6.1f%% %10zu %12u %8u %8u\n", cost->name.c_str(), cost->seconds * 1000,
+                 total > 0 ? cost->seconds / total * 100 : 0.0, cost->exprs, cost->instructions, cost->blocks, cost->phis);
+        out << line;
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <llvm/Support/TimeProfiler.h>
+
+#include <chrono>
+#include <ostream>
+#include <string>
+
+namespace llvm {
+class Function;
+}
+
+class Program;
+
+/**
+ * @brief The FunctionCost struct holds the time and the number of expressions spent on one function in all passes,
+ * together with the size of the function, which is kept because the module does not outlive the parser.
+ */
+struct FunctionCost {
+    // the size is filled in the first scope of the function, the name of an unnamed function is empty
+    bool initialized = false;
+    std::string name;
+    unsigned instructions = 0;
+    unsigned blocks = 0;
+    unsigned phis = 0;
+
+    double seconds = 0;
+    size_t exprs = 0;
+};
+
+/**
+ * @brief The FunctionScope class measures processing of one function inside a pass.
+ * The time and the expressions created in the scope are added to Program::functionCosts
+ * and the scope is recorded as an event of --trace.
+ */
+class FunctionScope {
+private:
+    Program& program;
+    const llvm::Function& func;
+    llvm::TimeTraceScope trace;
+    std::chrono::steady_clock::time_point start;
+    size_t startExprs;
+
+public:
+    FunctionScope(Program& program, const llvm::Function& func);
+    ~FunctionScope();
+};
+
+/**
+ * @brief printFunctionCosts Prints the functions with the highest time spent in the passes.
+ * @param out Output stream
+ * @param program Translated program
+ * @param top Maximum number of printed functions
+ */
+void printFunctionCosts(std::ostream& out, const Program& program, unsigned top);
@@ -0,0 +1,175 @@
+#include "MemStats.h"
+
+#include "Program.h"
+#include "../expr/Expr.h"
+#include "../expr/UnaryExpr.h"
+#include "../expr/BinaryExpr.h"
+#include "../type/Type.h"
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <tuple>
+#include <vector>
+
+struct KindInfo {
+    const char* name;
+    size_t size; // size of one object, without memory owned by its members
+};
+
+static KindInfo exprKindInfo(Expr::ExprKind kind) {
+    switch (kind) {
+    case Expr::EK_AggregateElement: return { "AggregateElement", sizeof(AggregateElement) };
+    case Expr::EK_ArrayElement: return { "ArrayElement", sizeof(ArrayElement) };
+    case Expr::EK_ExtractValueExpr: return { "ExtractValueExpr", sizeof(ExtractValueExpr) };
+    case Expr::EK_Value: return { "Value", sizeof(Value) };
+    case Expr::EK_GlobalValue: return { "GlobalValue", sizeof(GlobalValue) };
+    case Expr::EK_IfExpr: return { "IfExpr", sizeof(IfExpr) };
+    case Expr::EK_GotoExpr: return { "GotoExpr", sizeof(GotoExpr) };
+    case Expr::EK_SwitchExpr: return { "SwitchExpr", sizeof(SwitchExpr) };
+    case Expr::EK_AsmExpr: return { "AsmExpr", sizeof(AsmExpr) };
+    case Expr::EK_CallExpr: return { "CallExpr", sizeof(CallExpr) };
+    case Expr::EK_PointerShift: return { "PointerShift", sizeof(PointerShift) };
+    case Expr::EK_GepExpr: return { "GepExpr", sizeof(GepExpr) };
+    case Expr::EK_SelectExpr: return { "SelectExpr", sizeof(SelectExpr) };
+    case Expr::EK_StackAlloc: return { "StackAlloc", sizeof(StackAlloc) };
+    case Expr::EK_RefExpr: return { "RefExpr", sizeof(RefExpr) };
+    case Expr::EK_DerefExpr: return { "DerefExpr", sizeof(DerefExpr) };
+    case Expr::EK_RetExpr: return { "RetExpr", sizeof(RetExpr) };
+    case Expr::EK_CastExpr: return { "CastExpr", sizeof(CastExpr) };
+    case Expr::EK_AddExpr: return { "AddExpr", sizeof(AddExpr) };
+    case Expr::EK_SubExpr: return { "SubExpr", sizeof(SubExpr) };
+    case Expr::EK_AssignExpr: return { "AssignExpr", sizeof(AssignExpr) };
+    case Expr::EK_MulExpr: return { "MulExpr", sizeof(MulExpr) };
+    case Expr::EK_DivExpr: return { "DivExpr", sizeof(DivExpr) };
+    case Expr::EK_RemExpr: return { "RemExpr", sizeof(RemExpr) };
+    case Expr::EK_AndExpr: return { "AndExpr", sizeof(AndExpr) };
+    case Expr::EK_OrExpr: return { "OrExpr", sizeof(OrExpr) };
+    case Expr::EK_XorExpr: return { "XorExpr", sizeof(XorExpr) };
+    case Expr::EK_CmpExpr: return { "CmpExpr", sizeof(CmpExpr) };
+    case Expr::EK_AshrExpr: return { "AshrExpr", sizeof(AshrExpr) };
+    case Expr::EK_LshrExpr: return { "LshrExpr", sizeof(LshrExpr) };
+    case Expr::EK_ShlExpr: return { "ShlExpr", sizeof(ShlExpr) };
+    case Expr::EK_AggregateInitializer: return { "AggregateInitializer", sizeof(AggregateInitializer) };
+    case Expr::EK_DataInitializer: return { "DataInitializer", sizeof(DataInitializer) };
+    case Expr::EK_ArrowExpr: return { "ArrowExpr", sizeof(ArrowExpr) };
+    case Expr::EK_LogicalAnd: return { "LogicalAnd", sizeof(LogicalAnd) };
+    case Expr::EK_LogicalOr: return { "LogicalOr", sizeof(LogicalOr) };
+    case Expr::EK_LogicalNot: return { "LogicalNot", sizeof(LogicalNot) };
+    case Expr::EK_ExprList: return { "ExprList", sizeof(ExprList) };
+    case Expr::EK_MinusExpr: return { "MinusExpr", sizeof(MinusExpr) };
+    case Expr::EK_DoWhile: return { "DoWhile", sizeof(DoWhile) };
+    case Expr::EK_WhileExpr: return { "WhileExpr", sizeof(WhileExpr) };
+    case Expr::EK_BreakExpr: return { "BreakExpr", sizeof(BreakExpr) };
+    case Expr::EK_ContinueExpr: return { "ContinueExpr", sizeof(ContinueExpr) };
+    case Expr::EK_LabelExpr: return { "LabelExpr", sizeof(LabelExpr) };
+    case Expr::EK_KindCount: break;
+    }
+
+    return { "unknown", 0 };
+}
+
+static KindInfo typeKindInfo(Type::TypeKind kind) {
+    switch (kind) {
+    case Type::TK_FunctionPointerType: return { "FunctionPointerType", sizeof(FunctionPointerType) };
+    case Type::TK_StructType: return { "StructType", sizeof(StructType) };
+    case Type::TK_UnionType: return { "UnionType", sizeof(UnionType) };
+    case Type::TK_PointerType: return { "PointerType", sizeof(PointerType) };
+    case Type::TK_ArrayType: return { "ArrayType", sizeof(ArrayType) };
+    case Type::TK_VectorType: return { "VectorType", sizeof(VectorType) };
+    case Type::TK_VoidType: return { "VoidType", sizeof(VoidType) };
+    case Type::TK_IntegerType: return { "IntegerType", sizeof(IntegerType) };
+    case Type::TK_CharType: return { "CharType", sizeof(CharType) };
+    case Type::TK_IntType: return { "IntType", sizeof(IntType) };
+    case Type::TK_ShortType: return { "ShortType", sizeof(ShortType) };
+    case Type::TK_LongType: return { "LongType", sizeof(LongType) };
+    case Type::TK_Int128: return { "Int128", sizeof(Int128) };
+    case Type::TK_FloatingPointType: return { "FloatingPointType", sizeof(FloatingPointType) };
+    case Type::TK_FloatType: return { "FloatType", sizeof(FloatType) };
+    case Type::TK_DoubleType: return { "DoubleType", sizeof(DoubleType) };
+    case Type::TK_LongDoubleType: return { "LongDoubleType", sizeof(LongDoubleType) };
+    case Type::TK_KindCount: break;
+    }
+
+    return { "unknown", 0 };
+}
+
+static std::string formatBytes(double bytes) {
+    char buffer[32];
+    if (bytes >= 1024 * 1024) {
+        snprintf(buffer, sizeof(buffer), "%.1f MiB", bytes / (1024 * 1024));
+    } else {
+        snprintf(buffer, sizeof(buffer), "%.1f KiB", bytes / 1024);
+    }
+    return buffer;
+}
+
+/**
+ * @brief printKinds Prints the kinds with at least one live object, the largest first.
+ * @param rows Tuples of name, count and size of one object
+ */
+static void printKinds(std::ostream& out, const char* title, std::vector<std::tuple<const char*, size_t, size_t>>& rows) {
+    size_t count = 0;
+    size_t bytes = 0;
+    for (const auto& row : rows) {
+        count += std::get<1>(row);
+        bytes += std::get<1>(row) * std::get<2>(row);
+    }
+
+    std::sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) {
+        return std::get<1>(a) * std::get<2>(a) > std::get<1>(b) * std::get<2>(b);
+    });
+
+    out << title << ": " << count << ", ~" << formatBytes(bytes) << "\n";
+    for (const auto& row : rows) {
+        if (std::get<1>(row) == 0) {
+            continue;
+        }
+
+        char line[96];
+        snprintf(line, sizeof(line), "  %-22s %10zu %14s\n", std::get<0>(row), std::get<1>(row), formatBytes(std::get<1>(row) * std::get<2>(row)).c_str());
+        out << line;
+    }
+}
+
+void printMemStats(std::ostream& out, const std::string& pass, const Program& program) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    out << "=== memory after " << pass << ", peak RSS " << formatBytes(usage.ru_maxrss * 1024.0) << " ===\n";
+
+    std::vector<std::tuple<const char*, size_t, size_t>> exprs;
+    for (unsigned kind = 0; kind < Expr::EK_KindCount; kind++) {
+        auto info = exprKindInfo(static_cast<Expr::ExprKind>(kind));
+        exprs.emplace_back(info.name, Expr::getLiveCount(static_cast<Expr::ExprKind>(kind)), info.size);
+    }
+    printKinds(out, "expressions", exprs);
+
+    std::vector<std::tuple<const char*, size_t, size_t>> types;
+    for (unsigned kind = 0; kind < Type::TK_KindCount; kind++) {
+        auto info = typeKindInfo(static_cast<Type::TypeKind>(kind));
+        types.emplace_back(info.name, Type::getLiveCount(static_cast<Type::TypeKind>(kind)), info.size);
+    }
+    printKinds(out, "types", types);
+
+    size_t metadataNames = 0;
+    size_t maxMetadataNames = 0;
+    std::string maxFunction;
+    for (const auto& entry : program.functions) {
+        size_t names = entry.second->metadataVarNames.size();
+        metadataNames += names;
+        if (names > maxMetadataNames) {
+            maxMetadataNames = names;
+            maxFunction = entry.second->name;
+        }
+    }
+
+    out << "exprMap: " << program.exprMap.size() << " (~" << formatBytes(program.exprMap.getMemorySize()) << ")"
+        << ", ownership: " << program.ownership.size() << " (~" << formatBytes(program.ownership.capacity() * sizeof(program.ownership[0])) << ")"
+        << ", globalVarNames: " << program.globalVarNames.size()
+        << ", metadataVarNames: " << metadataNames << " in " << program.functions.size() << " functions";
+    if (maxMetadataNames) {
+        out << " (max " << maxMetadataNames << " in " << maxFunction << ")";
+    }
+    out << "\n";
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+
+class Program;
+
+/**
+ * @brief printMemStats Prints the number and approximate size of existing expressions and types by kind,
+ * sizes of the containers of the program and peak RSS of the process.
+ * @param out Output stream
+ * @param pass Name of the pass that has just finished
+ * @param program Translated program
+ */
+void printMemStats(std::ostream& out, const std::string& pass, const Program& program);
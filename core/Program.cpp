@@ -25,30 +25,28 @@ std::string Program::getAnonStructName() {
 StructType* Program::getStruct(const llvm::StructType* strct) const {
 	std::string structName = TypeHandler::getStructName(strct->getName().str());
 
-	for (const auto& structElem : structs) {
-		if (structElem->name.compare(structName) == 0) {
-			return structElem.get();
-		}
+	auto named = structsByName.find(structName);
+	if (named != structsByName.end()) {
+		return named->second;
 	}
 
-	if (unnamedStructs.find(strct) != unnamedStructs.end()) {
-		return unnamedStructs.find(strct)->second.get();
+	auto unnamed = unnamedStructs.find(strct);
+	if (unnamed != unnamedStructs.end()) {
+		return unnamed->second.get();
 	}
 
 	return nullptr;
 }
 
 StructType* Program::getStruct(const std::string& name) const {
-	for (const auto& structElem : structs) {
-		if (structElem->name.compare(name) == 0) {
-			return structElem.get();
-		}
+	auto named = structsByName.find(name);
+	if (named != structsByName.end()) {
+		return named->second;
 	}
 
-	for (const auto& mapElem : unnamedStructs) {
-		if (mapElem.second->name.compare(name) == 0) {
-			return mapElem.second.get();
-		}
+	auto unnamed = unnamedStructsByName.find(name);
+	if (unnamed != unnamedStructsByName.end()) {
+		return unnamed->second;
 	}
 
 	return nullptr;
@@ -75,6 +73,8 @@ void Program::createNewUnnamedStruct(const llvm::StructType *strct) {
 		structExpr->addItem(getType(type), getStructVarName());
 	}
 
+	unnamedStructsByName.emplace(structExpr->name, structExpr.get());
+	sortedUnnamedStructs.push_back(structExpr.get());
 	unnamedStructs[strct] = std::move(structExpr);
 }
 
@@ -102,6 +102,8 @@ void Program::addFunction(const llvm::Function* llvmFunc, std::unique_ptr<Func>
 }
 
 void Program::addStruct(std::unique_ptr<StructType> strct) {
+	// the first struct with the given name is found by getStruct
+	structsByName.emplace(strct->name, strct.get());
 	structs.push_back(std::move(strct));
 }
 
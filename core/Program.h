@@ -3,6 +3,7 @@
 #include <vector>
 #include <set>
 #include <unordered_set>
+#include <unordered_map>
 
 #include <llvm/Support/SourceMgr.h>
 #include <llvm/IR/Module.h>
@@ -12,6 +13,8 @@
 #include "../expr/Expr.h"
 #include "../type/TypeHandler.h"
 #include "PassType.h"
+#include "Statistics.h"
+#include "FunctionCost.h"
 
 class ProgramParser;
 
@@ -35,6 +38,11 @@ public:
     std::vector<std::unique_ptr<GlobalValue>> globalVars; // vector of parsed global variables
     llvm::DenseMap<const llvm::GlobalVariable*, std::unique_ptr<RefExpr>> globalRefs; //map containing references to global variables
     llvm::DenseMap<const llvm::StructType*, std::unique_ptr<StructType>> unnamedStructs; // map containing unnamed structs
+    std::vector<const StructType*> sortedUnnamedStructs; // unnamed structs in the order of creation, used in output
+
+    // structs and unnamed structs indexed by name, so that getStruct does not have to scan them
+    std::unordered_map<std::string, StructType*> structsByName;
+    std::unordered_map<std::string, StructType*> unnamedStructsByName;
 
     llvm::DenseMap<const llvm::Value*, Expr*> exprMap; // DenseMap used for mapping llvm::Value to Expr
 
@@ -47,6 +55,12 @@ public:
     // union used for bitcasts from LLVM
     UnionType* bitcastUnion = nullptr;
 
+    // counters of transformations done by the passes, printed by --stats
+    Statistics stats;
+
+    // time and expressions spent on every function inside the passes, printed by --function-costs
+    llvm::DenseMap<const llvm::Function*, FunctionCost> functionCosts;
+
     // set of passes applied to the program
     std::unordered_set<PassType> passes;
 
@@ -0,0 +1,21 @@
+#include "Statistics.h"
+
+#include <cstdio>
+
+static void printCounter(std::ostream& out, unsigned value, const char* description) {
+    char line[96];
+    snprintf(line, sizeof(line), "%10u %s\n", value, description);
+    out << line;
+}
+
+void Statistics::print(std::ostream& out) const {
+    out << "=== llvm2c statistics ===\n";
+    printCounter(out, inlinedExprs, "expressions inlined into their use");
+    printCounter(out, materializedExprs, "expressions materialized as variables");
+    printCounter(out, phiVariables, "phi variables created");
+    printCounter(out, inlinedBlocks, "blocks inlined");
+    printCounter(out, addedSignCasts, "sign casts added");
+    printCounter(out, removedCasts, "redundant casts removed");
+    printCounter(out, convertedMemcpys, "memcpys converted to assignments");
+    printCounter(out, deletedAllocas, "unused allocas deleted");
+}
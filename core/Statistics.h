@@ -0,0 +1,23 @@
+#pragma once
+
+#include <ostream>
+
+/**
+ * @brief The Statistics struct counts transformations done by the passes during translation of one program,
+ * similarly to LLVM STATISTIC counters.
+ */
+struct Statistics {
+    unsigned inlinedExprs = 0; // values inlined into their use by createExpressions
+    unsigned materializedExprs = 0; // values stored to a new variable by createExpressions
+    unsigned phiVariables = 0; // variables created for phi nodes
+    unsigned inlinedBlocks = 0; // gotos replaced by the body of their target by inlineBlocks
+    unsigned addedSignCasts = 0; // casts added by addSignCasts
+    unsigned removedCasts = 0; // nested casts removed by deleteRedundantCasts
+    unsigned convertedMemcpys = 0; // memcpy calls replaced by assignments by memcpyToAssignment
+    unsigned deletedAllocas = 0; // allocas deleted by deleteUnusedVariables
+
+    /**
+     * @brief print Prints all counters, one per line.
+     */
+    void print(std::ostream& out) const;
+};
@@ -3,6 +3,10 @@
 #include "../type/TypeHandler.h"
 
 #include "llvm/Support/raw_ostream.h"
+
+size_t Expr::liveCount[Expr::EK_KindCount] = {};
+size_t Expr::createdCount = 0;
+
 AggregateElement::AggregateElement(Expr* expr, unsigned element)
     : ExprBase(EK_AggregateElement),
       expr(expr),
@@ -115,7 +119,7 @@ bool IfExpr::classof(const Expr* expr) {
     return expr->getKind() == EK_IfExpr;
 }
 
-SwitchExpr::SwitchExpr(Expr* cmp, Expr* def, std::map<int, Expr*> cases)
+SwitchExpr::SwitchExpr(Expr* cmp, Expr* def, std::vector<std::pair<int, Expr*>> cases)
     : ExprBase(EK_SwitchExpr),
       cmp(cmp),
       def(def),
@@ -236,6 +240,17 @@ bool StackAlloc::classof(const Expr* expr) {
 
 AggregateInitializer::AggregateInitializer(std::vector<Expr*> values): ExprBase(EK_AggregateInitializer), values(values) { }
 
+AggregateInitializer::AggregateInitializer(std::vector<Expr*> values, std::vector<unsigned> indices)
+    : ExprBase(EK_AggregateInitializer),
+      values(std::move(values)),
+      indices(std::move(indices)) {
+    assert(this->indices.empty() || this->values.size() == this->indices.size());
+}
+
+bool AggregateInitializer::isZero() const {
+    return values.empty();
+}
+
 bool AggregateInitializer::classof(const Expr* expr) {
     return expr->getKind() == EK_AggregateInitializer;
 }
@@ -244,6 +259,40 @@ void AggregateInitializer::accept(ExprVisitor& visitor) {
     visitor.visit(*this);
 }
 
+DataInitializer::DataInitializer(llvm::StringRef data, unsigned elementSize, bool isFloatingPoint, Type* type)
+    : ExprBase(EK_DataInitializer),
+      data(data.str()),
+      elementSize(elementSize),
+      isFloatingPoint(isFloatingPoint),
+      designated(false) {
+    setType(type);
+
+    size_t nonZero = 0;
+    for (size_t i = 0; i < this->data.size(); i += elementSize) {
+        for (size_t j = i; j < i + elementSize; ++j) {
+            if (this->data[j] != 0) {
+                ++nonZero;
+                break;
+            }
+        }
+    }
+
+    // strings are always written as string literals, vectors cannot be initialized by designators
+    designated = elementSize > 1 && nonZero * 2 < getNumElements() && !llvm::isa_and_nonnull<VectorType>(type);
+}
+
+size_t DataInitializer::getNumElements() const {
+    return data.size() / elementSize;
+}
+
+void DataInitializer::accept(ExprVisitor& visitor) {
+    visitor.visit(*this);
+}
+
+bool DataInitializer::classof(const Expr* expr) {
+    return expr->getKind() == EK_DataInitializer;
+}
+
 ArrowExpr::ArrowExpr(Expr* expr, unsigned element) : ExprBase(EK_ArrowExpr), expr(expr), element(element) {
 
     auto* ty = llvm::dyn_cast<PointerType>(expr->getType());
@@ -307,7 +356,7 @@ bool ExprList::classof(const Expr* expr) {
     return expr->getKind() == EK_ExprList;
 }
 
-DoWhile::DoWhile(Expr* body, Expr* cond): Expr(EK_DoWhile), body(body), cond(cond) { }
+DoWhile::DoWhile(Expr* body, Expr* cond): ExprBase(EK_DoWhile), body(body), cond(cond) { }
 
 void DoWhile::accept(ExprVisitor& visitor) {
     visitor.visit(*this);
@@ -316,3 +365,43 @@ void DoWhile::accept(ExprVisitor& visitor) {
 bool DoWhile::classof(const Expr* expr) {
     return expr->getKind() == EK_DoWhile;
 }
+
+WhileExpr::WhileExpr(Expr* cond, Expr* body): ExprBase(EK_WhileExpr), cond(cond), body(body) { }
+
+void WhileExpr::accept(ExprVisitor& visitor) {
+    visitor.visit(*this);
+}
+
+bool WhileExpr::classof(const Expr* expr) {
+    return expr->getKind() == EK_WhileExpr;
+}
+
+BreakExpr::BreakExpr(): ExprBase(EK_BreakExpr) { }
+
+void BreakExpr::accept(ExprVisitor& visitor) {
+    visitor.visit(*this);
+}
+
+bool BreakExpr::classof(const Expr* expr) {
+    return expr->getKind() == EK_BreakExpr;
+}
+
+ContinueExpr::ContinueExpr(): ExprBase(EK_ContinueExpr) { }
+
+void ContinueExpr::accept(ExprVisitor& visitor) {
+    visitor.visit(*this);
+}
+
+bool ContinueExpr::classof(const Expr* expr) {
+    return expr->getKind() == EK_ContinueExpr;
+}
+
+LabelExpr::LabelExpr(Block* block): ExprBase(EK_LabelExpr), block(block) { }
+
+void LabelExpr::accept(ExprVisitor& visitor) {
+    visitor.visit(*this);
+}
+
+bool LabelExpr::classof(const Expr* expr) {
+    return expr->getKind() == EK_LabelExpr;
+}
@@ -5,6 +5,7 @@
 #include <vector>
 #include <memory>
 
+#include "llvm/ADT/StringRef.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Support/Casting.h"
 
@@ -53,6 +54,7 @@ public:
         EK_LshrExpr,
         EK_ShlExpr,
         EK_AggregateInitializer,
+        EK_DataInitializer,
         EK_ArrowExpr,
         EK_LogicalAnd,
         EK_LogicalOr,
@@ -61,14 +63,30 @@ public:
         EK_ExprList,
         EK_MinusExpr,
         EK_DoWhile,
+        EK_WhileExpr,
+        EK_BreakExpr,
+        EK_ContinueExpr,
+        EK_LabelExpr,
+
+        EK_KindCount // number of kinds, must stay last
     };
 private:
     const ExprKind kind;
+
+    // number of existing expressions of every kind, reported by --mem-stats
+    static size_t liveCount[EK_KindCount];
+
+    // number of expressions created so far, used for attributing allocations to functions
+    static size_t createdCount;
 public:
     ExprKind getKind() const { return kind; }
-    Expr(ExprKind kind): kind(kind) {}
+    Expr(ExprKind kind): kind(kind) { liveCount[kind]++; createdCount++; }
+    Expr(const Expr& other): kind(other.kind) { liveCount[kind]++; createdCount++; }
+
+    virtual ~Expr() { liveCount[kind]--; }
 
-    virtual ~Expr() = default;
+    static size_t getLiveCount(ExprKind kind) { return liveCount[kind]; }
+    static size_t getCreatedCount() { return createdCount; }
     virtual void accept(ExprVisitor& visitor) = 0;
     virtual const Type* getType() const = 0;
     virtual Type* getType() = 0;
@@ -170,6 +188,7 @@ public:
 class Value : public ExprBase {
 public:
     std::string valueName;
+    unsigned alignment = 0; //alignment in bytes if it exceeds the natural alignment of the type, 0 otherwise
 
     Value(const std::string&, Type*);
     Value(const std::string&, Type*, ExprKind kind);
@@ -190,6 +209,7 @@ class GlobalValue : public Value {
 public:
     Expr* value;
     bool isStatic = false;
+    bool isConstant = false; //global variable is read-only
 
     GlobalValue(const std::string&, Expr*, Type*);
 
@@ -238,9 +258,9 @@ class SwitchExpr : public ExprBase {
 public:
     Expr* cmp; //expression used in switch
     Expr* def; //default
-    std::map<int, Expr*> cases; //cases of switch
+    std::vector<std::pair<int, Expr*>> cases; //cases of switch in the order in which they are written
 
-    SwitchExpr(Expr*, Expr*, std::map<int, Expr*>);
+    SwitchExpr(Expr*, Expr*, std::vector<std::pair<int, Expr*>>);
 
     void accept(ExprVisitor& visitor) override;
 
@@ -345,11 +365,39 @@ public:
     static bool classof(const Expr* expr);
 };
 
+/**
+ * @brief The AggregateInitializer class represents initializer of a struct or an array.
+ * Initializer without values zero-initializes the whole aggregate.
+ */
 class AggregateInitializer : public ExprBase {
 public:
     std::vector<Expr *> values;
+    std::vector<unsigned> indices; //indices of initialized elements (designated initializer), empty if values initialize elements in order
 
     AggregateInitializer(std::vector<Expr *> values);
+    AggregateInitializer(std::vector<Expr *> values, std::vector<unsigned> indices);
+
+    bool isZero() const override;
+
+    void accept(ExprVisitor& visitor) override;
+
+    static bool classof(const Expr* expr);
+};
+
+/**
+ * @brief The DataInitializer class represents initializer of an array of simple elements (LLVM ConstantDataSequential).
+ * It keeps the raw data of the constant instead of one expression per element.
+ */
+class DataInitializer : public ExprBase {
+public:
+    std::string data; //raw bytes of the elements
+    unsigned elementSize; //size of one element in bytes
+    bool isFloatingPoint; //elements are float or double
+    bool designated; //most elements are zero, only non-zero elements are initialized
+
+    DataInitializer(llvm::StringRef data, unsigned elementSize, bool isFloatingPoint, Type* type);
+
+    size_t getNumElements() const;
 
     void accept(ExprVisitor& visitor) override;
 
@@ -396,7 +444,7 @@ public:
     static bool classof(const Expr* expr);
 };
 
-class DoWhile : public Expr {
+class DoWhile : public ExprBase {
 public:
     Expr* body;
     Expr* cond;
@@ -407,3 +455,56 @@ public:
 
     static bool classof(const Expr* expr);
 };
+
+/**
+ * @brief The WhileExpr class represents while loop, an infinite one if cond is nullptr.
+ */
+class WhileExpr : public ExprBase {
+public:
+    Expr* cond;
+    Expr* body;
+
+    WhileExpr(Expr* cond, Expr* body);
+
+    void accept(ExprVisitor& visitor) override;
+
+    static bool classof(const Expr* expr);
+};
+
+/**
+ * @brief The BreakExpr class represents break statement.
+ */
+class BreakExpr : public ExprBase {
+public:
+    BreakExpr();
+
+    void accept(ExprVisitor& visitor) override;
+
+    static bool classof(const Expr* expr);
+};
+
+/**
+ * @brief The ContinueExpr class represents continue statement.
+ */
+class ContinueExpr : public ExprBase {
+public:
+    ContinueExpr();
+
+    void accept(ExprVisitor& visitor) override;
+
+    static bool classof(const Expr* expr);
+};
+
+/**
+ * @brief The LabelExpr class represents label of a block that is a target of goto in structured code.
+ */
+class LabelExpr : public ExprBase {
+public:
+    Block* block;
+
+    LabelExpr(Block* block);
+
+    void accept(ExprVisitor& visitor) override;
+
+    static bool classof(const Expr* expr);
+};
@@ -31,6 +31,7 @@ class LshrExpr;
 class ShlExpr;
 class StackAlloc;
 class AggregateInitializer;
+class DataInitializer;
 class ArrowExpr;
 class LogicalAnd;
 class LogicalOr;
@@ -39,6 +40,10 @@ class GotoExpr;
 class ExprList;
 class MinusExpr;
 class DoWhile;
+class WhileExpr;
+class BreakExpr;
+class ContinueExpr;
+class LabelExpr;
 
 class ExprVisitor {
 public:
@@ -73,6 +78,7 @@ public:
     virtual void visit(ShlExpr& ) {}
     virtual void visit(StackAlloc& ) {}
     virtual void visit(AggregateInitializer& ) {}
+    virtual void visit(DataInitializer& ) {}
     virtual void visit(ArrowExpr& ) {}
     virtual void visit(LogicalAnd& ) {}
     virtual void visit(LogicalOr& ) {}
@@ -81,6 +87,10 @@ public:
     virtual void visit(MinusExpr& ) {}
     virtual void visit(LogicalNot& ) {}
     virtual void visit(DoWhile& ) {}
+    virtual void visit(WhileExpr& ) {}
+    virtual void visit(BreakExpr& ) {}
+    virtual void visit(ContinueExpr& ) {}
+    virtual void visit(LabelExpr& ) {}
 
     virtual ~ExprVisitor() = default;
 };
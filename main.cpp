@@ -1,9 +1,13 @@
+#include "core/MemStats.h"
 #include "core/Program.h"
 #include "parser/ProgramParser.h"
 #include "writer/Writer.h"
 
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Support/CommandLine.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/Support/TimeProfiler.h"
 
 #include <iostream>
 #include <fstream>
@@ -19,6 +23,13 @@ int main(int argc, char** argv) {
     cl::opt<bool> Includes("add-includes", cl::desc("Uses includes instead of declarations. For experimental purposes."), cl::cat(options));
     cl::opt<bool> Casts("no-function-call-casts", cl::desc("Removes casts around function calls. For experimental purposes."), cl::cat(options));
     cl::opt<bool> BlockLabels("force-block-labels", cl::desc("Forces printing of block labels of inlined blocks"), cl::cat(options));
+    cl::opt<unsigned> BlobThreshold("blob-threshold", cl::desc("Writes initializers of global arrays with at least <bytes> bytes to side files next to the output, 0 disables side files"), cl::value_desc("bytes"), cl::init(0), cl::cat(options));
+    cl::opt<bool> BlobEmbed("blob-embed", cl::desc("Includes side files of byte arrays using C23 #embed instead of .incbin"), cl::cat(options));
+    cl::opt<bool> Structured("structured", cl::desc("Recovers loops, conditionals, break and continue instead of emitting gotos between blocks"), cl::cat(options));
+    cl::opt<std::string> Trace("trace", cl::desc("Writes Chrome trace events of IR parsing, passes, functions and writer sections to <filename>"), cl::value_desc("filename"), cl::cat(options));
+    cl::opt<unsigned> TraceGranularity("trace-granularity", cl::desc("Minimum duration of a traced event in microseconds"), cl::init(10), cl::cat(options));
+    cl::opt<unsigned> FunctionCosts("function-costs", cl::desc("Prints <n> functions with the highest time spent in the passes, with their expressions, instructions, blocks and phis"), cl::value_desc("n"), cl::init(0), cl::cat(options));
+    cl::opt<bool> MemStats("mem-stats", cl::desc("Prints number and size of expressions and types, sizes of internal containers and peak RSS after every pass"), cl::cat(options));
 
     cl::HideUnrelatedOptions(options);
     cl::ParseCommandLineOptions(argc, argv);
@@ -28,12 +39,29 @@ int main(int argc, char** argv) {
         return 1;
     }
 
+    if (!Trace.empty()) {
+        timeTraceProfilerInitialize(TraceGranularity, "llvm2c");
+    }
+
     try {
-        ProgramParser parser;
+        ProgramParser parser(true, Structured);
+        if (MemStats) {
+            parser.afterPass = [](const std::string& pass, const Program& program) {
+                printMemStats(std::cerr, pass, program);
+            };
+        }
         auto program = parser.parse(Input);
+        // --stats is the option of LLVM itself, it is reused so that the counters are printed together with LLVM ones
+        if (AreStatisticsEnabled()) {
+            program.stats.print(std::cerr);
+        }
+        if (FunctionCosts) {
+            printFunctionCosts(std::cerr, program, FunctionCosts);
+        }
 
         if (Print) {
-            Writer wr{ std::cout, Includes, Casts, BlockLabels };
+            // side files belong to the output file if there is one
+            Writer wr{ std::cout, Includes, Casts, BlockLabels, BlobThreshold, Output.empty() ? Input : Output, BlobEmbed };
             wr.writeProgram(program);
         }
 
@@ -43,7 +71,7 @@ int main(int argc, char** argv) {
             if (!file.is_open()) {
                 throw std::invalid_argument("Output file cannot be opened!");
             }
-            Writer wr{ file, Includes, Casts, BlockLabels };
+            Writer wr{ file, Includes, Casts, BlockLabels, BlobThreshold, Output, BlobEmbed };
             wr.writeProgram(program);
         }
 
@@ -52,5 +80,16 @@ int main(int argc, char** argv) {
         return 1;
     }
 
+    if (!Trace.empty()) {
+        std::error_code error;
+        raw_fd_ostream file(Trace, error, sys::fs::OF_None);
+        if (error) {
+            std::cerr << "Trace file cannot be opened!\n";
+            return 1;
+        }
+        timeTraceProfilerWrite(file);
+        timeTraceProfilerCleanup();
+    }
+
     return 0;
 }
@@ -3,28 +3,52 @@
 
 #include <llvm/IR/Constants.h>
 #include <llvm/IRReader/IRReader.h>
+#include <llvm/Support/TimeProfiler.h>
 #include <iostream>
+#include <chrono>
 
 #define RUN_PASS(pass) \
     do {\
-        puts("    Starting pass: " #pass );\
-        pass(mod, result); \
+        if (verbose) {\
+            puts("    Starting pass: " #pass );\
+            fflush(stdout); /* the last started pass is reported even if the pass crashes */\
+        }\
+        auto passStart = std::chrono::steady_clock::now();\
+        {\
+            llvm::TimeTraceScope passScope("Pass", #pass);\
+            pass(mod, result); \
+        }\
+        std::chrono::duration<double> passTime = std::chrono::steady_clock::now() - passStart;\
+        passTimes.emplace_back(#pass, passTime.count());\
+        if (afterPass) {\
+            afterPass(#pass, result);\
+        }\
     } while (0);
 
 
 Program ProgramParser::parse(const std::string& file) {
-    Program result;
     llvm::LLVMContext context;
 
     auto error = llvm::SMDiagnostic();
-    auto module = llvm::parseIRFile(file, error, context);
+    std::unique_ptr<llvm::Module> module;
+    {
+        llvm::TimeTraceScope parseScope("Parse IR", file);
+        module = llvm::parseIRFile(file, error, context);
+    }
     if (!module) {
         throw std::invalid_argument("Error loading module - invalid input file:\n" + file + "\n");
     }
 
-    const auto* mod = module.get();
+    return parse(module.get());
+}
+
+Program ProgramParser::parse(const llvm::Module* mod) {
+    Program result;
+    passTimes.clear();
 
-    std::cerr << "Parser start" << std::endl;
+    if (verbose) {
+        std::cerr << "Parser start" << std::endl;
+    }
     RUN_PASS(determineIncludes);
     RUN_PASS(parseStructDeclarations);
     RUN_PASS(parseStructItems);
@@ -56,9 +80,15 @@ Program ProgramParser::parse(const std::string& file) {
     RUN_PASS(addSignCasts);
     RUN_PASS(deleteRedundantCasts);
     RUN_PASS(extractVars);
-    RUN_PASS(identifyInlinableBlocks);
-    RUN_PASS(inlineBlocks);
-    std::cerr << "Parser end" << std::endl;
+    if (structured) {
+        RUN_PASS(structureControlFlow);
+    } else {
+        RUN_PASS(identifyInlinableBlocks);
+        RUN_PASS(inlineBlocks);
+    }
+    if (verbose) {
+        std::cerr << "Parser end" << std::endl;
+    }
 
     return result;
 }
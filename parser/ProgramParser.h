@@ -2,13 +2,41 @@
 
 #include "../core/Program.h"
 
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace llvm {
+class Module;
+}
 
 class ProgramParser
 {
 private:
+    bool verbose;
+
+    // recover loops and conditionals instead of inlining single-predecessor blocks
+    bool structured;
+
+    // wall-clock duration (in seconds) of every pass of the last parse, in the order the passes ran
+    std::vector<std::pair<std::string, double>> passTimes;
 
 public:
-    ProgramParser() = default;
+    // called after every pass with its name, used for reporting statistics of the program being built
+    std::function<void(const std::string& pass, const Program& program)> afterPass;
+
+    ProgramParser(bool verbose = true, bool structured = false) : verbose(verbose), structured(structured) {}
     Program parse(const std::string& from);
+
+    /**
+     * @brief parse Translates a module that has already been loaded into memory.
+     */
+    Program parse(const llvm::Module* mod);
+
+    const std::vector<std::pair<std::string, double>>& getPassTimes() const {
+        return passTimes;
+    }
+
     virtual ~ProgramParser() = default;
 };
@@ -26,8 +26,10 @@ void SimplifyingExprVisitor::visit(IfExpr& ifExpr) {
     ifExpr.trueList->accept(*this);
     ifExpr.trueList = simplify(ifExpr.trueList);
 
-    ifExpr.falseList->accept(*this);
-    ifExpr.falseList = simplify(ifExpr.falseList);
+    if (ifExpr.falseList) {
+        ifExpr.falseList->accept(*this);
+        ifExpr.falseList = simplify(ifExpr.falseList);
+    }
 }
 
 void SimplifyingExprVisitor::visit(SwitchExpr& expr) {
@@ -278,3 +280,13 @@ void SimplifyingExprVisitor::visit(DoWhile& expr) {
     expr.cond = simplify(expr.cond);
     expr.body = simplify(expr.body);
 }
+
+void SimplifyingExprVisitor::visit(WhileExpr& expr) {
+    if (expr.cond) {
+        expr.cond->accept(*this);
+        expr.cond = simplify(expr.cond);
+    }
+
+    expr.body->accept(*this);
+    expr.body = simplify(expr.body);
+}
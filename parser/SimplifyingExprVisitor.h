@@ -46,6 +46,7 @@ public:
     void visit(MinusExpr& expr) override;
     void visit(LogicalNot& expr) override;
     void visit(DoWhile& expr) override;
+    void visit(WhileExpr& expr) override;
 
     virtual ~SimplifyingExprVisitor() = default;
 };
@@ -48,6 +48,7 @@ public:
 void addSignCasts(const llvm::Module* module, Program& program) {
     assert(program.isPassCompleted(PassType::CreateExpressions));
     for (const llvm::Function& func : module->functions()) {
+        FunctionScope functionScope(program, func);
         auto* function = program.getFunction(&func);
         for (const auto& block : func) {
             auto* myBlock = function->getBlock(&block);
@@ -80,12 +81,16 @@ Expr* SignCastsVisitor::castIfNeeded(Expr* expr, bool isUnsigned) {
         auto cast = std::make_unique<CastExpr>(expr, newType);
         result = cast.get();
         block->addOwnership(std::move(cast));
+        program.stats.addedSignCasts++;
     }
 
     return result;
 }
 
 void SignCastsVisitor::visit(CmpExpr& expr) {
+    expr.left->accept(*this);
+    expr.right->accept(*this);
+
     // cast are not necessary in these cases
     if (expr.comparsion == "==" || expr.comparsion == "!=")
         return;
@@ -20,6 +20,7 @@ void arrowify(const llvm::Module* module, Program& program) {
 
     ArrowifyVisitor visitor{program};
     for (const llvm::Function& func : module->functions()) {
+        FunctionScope functionScope(program, func);
         auto* function = program.getFunction(&func);
         for (const auto& block : func) {
             auto* myBlock = function->getBlock(&block);
@@ -0,0 +1,38 @@
+#include "branchWeights.h"
+
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Metadata.h>
+
+std::vector<uint64_t> getBranchWeights(const llvm::Instruction& ins) {
+    std::vector<uint64_t> weights;
+
+    const auto* prof = ins.getMetadata(llvm::LLVMContext::MD_prof);
+    if (!prof || prof->getNumOperands() != ins.getNumSuccessors() + 1) {
+        return weights;
+    }
+
+    const auto* kind = llvm::dyn_cast<llvm::MDString>(prof->getOperand(0));
+    if (!kind || kind->getString() != "branch_weights") {
+        return weights;
+    }
+
+    for (unsigned i = 1; i < prof->getNumOperands(); ++i) {
+        const auto* weight = llvm::mdconst::dyn_extract<llvm::ConstantInt>(prof->getOperand(i));
+        if (!weight) {
+            return {};
+        }
+        weights.push_back(weight->getZExtValue());
+    }
+
+    return weights;
+}
+
+bool isLikely(uint64_t weight, uint64_t total) {
+    return total > 0 && (double)weight / total >= 0.9;
+}
+
+Expr* buildExpect(Program& program, Expr* value, const std::string& expected) {
+    auto* expectedValue = program.makeExpr<Value>(expected, program.typeHandler.slong.get());
+    return program.makeExpr<CallExpr>(nullptr, "__builtin_expect", std::vector<Expr*>{ value, expectedValue }, program.typeHandler.slong.get());
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "../core/Program.h"
+
+#include <llvm/IR/Instruction.h>
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief getBranchWeights Returns branch_weights profile metadata of the terminator.
+ * @param ins Terminator instruction
+ * @return One weight for every successor, empty if the terminator has no profile
+ */
+std::vector<uint64_t> getBranchWeights(const llvm::Instruction& ins);
+
+/**
+ * @brief isLikely Checks whether the successor is taken with probability of at least 90 %,
+ * which is the probability the C compilers assume for __builtin_expect.
+ * @param weight Weight of the successor
+ * @param total Sum of the weights of all successors
+ */
+bool isLikely(uint64_t weight, uint64_t total);
+
+/**
+ * @brief buildExpect Creates call of __builtin_expect telling the C compiler that value is probably equal to expected.
+ * @param program Program owning the created expressions
+ * @param value Expected expression
+ * @param expected C literal of the expected value
+ */
+Expr* buildExpect(Program& program, Expr* value, const std::string& expected);
@@ -2,10 +2,26 @@
 
 #include <string>
 
+#include <llvm/IR/Function.h>
+
 bool isCFunc(const std::string& func);
 
 std::string trimPrefix(const std::string& fname);
 
+/**
+ * @brief getBuiltinName Returns name of the compiler builtin that is called instead of the intrinsic.
+ * @param func LLVM function
+ * @return Name of the builtin, empty string if the function is not translated to a builtin
+ */
+std::string getBuiltinName(const llvm::Function* func);
+
+/**
+ * @brief isBuiltin Checks whether the function is a compiler builtin, which is never declared
+ * @param func Function name
+ * @return True if the name starts with __builtin_, false otherwise
+ */
+bool isBuiltin(const std::string& func);
+
 bool isCMath(const std::string& func);
 
 /**
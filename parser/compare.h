@@ -28,8 +28,8 @@ bool isIntegerCompareUnsigned(const llvm::CmpInst* cmp) {
     }
 }
 
-std::string getComparePredicate(const llvm::CmpInst* cmp) {
-    switch(cmp->getPredicate()) {
+std::string getComparePredicate(llvm::CmpInst::Predicate predicate) {
+    switch(predicate) {
     case llvm::CmpInst::ICMP_EQ:
     case llvm::CmpInst::FCMP_OEQ:
     case llvm::CmpInst::FCMP_UEQ:
@@ -63,3 +63,7 @@ std::string getComparePredicate(const llvm::CmpInst* cmp) {
 
     }
 }
+
+std::string getComparePredicate(const llvm::CmpInst* cmp) {
+    return getComparePredicate(cmp->getPredicate());
+}
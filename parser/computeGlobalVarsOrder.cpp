@@ -27,7 +27,7 @@ static void parseGlobalVar(const llvm::GlobalVariable& gvar, Program& program) {
     std::string gvarName = gvar.getName().str();
     std::replace(gvarName.begin(), gvarName.end(), '.', '_');
 
-    std::regex varName("var[0-9]+");
+    static const std::regex varName("var[0-9]+");
     if (std::regex_match(gvarName, varName)) {
         program.globalVarNames.insert(gvarName);
     }
@@ -43,6 +43,10 @@ static void parseGlobalVar(const llvm::GlobalVariable& gvar, Program& program) {
 
     auto var = std::make_unique<GlobalValue>(gvarName, nullptr, type);
     var->isStatic = gvar.hasInternalLinkage();
+    var->isConstant = gvar.isConstant();
+    if (gvar.getAlignment() > TypeHandler::variableAlignment(gvar.getParent()->getDataLayout(), gvar.getValueType())) {
+        var->alignment = gvar.getAlignment();
+    }
 
     program.globalRefs[&gvar] = std::make_unique<RefExpr>(var.get(), program.typeHandler.pointerTo(var->getType()));
 
@@ -3,6 +3,82 @@
 
 Expr* parseLLVMInstruction(const llvm::Instruction& ins, Program& program);
 
+/**
+ * @brief createZeroInitializer Creates a single initializer that zeroes the whole aggregate.
+ * @param ty LLVM type of the aggregate
+ */
+static Expr* createZeroInitializer(const llvm::Type* ty, Program& program) {
+    auto init = std::make_unique<AggregateInitializer>(std::vector<Expr*>{});
+    init->setType(program.getType(ty));
+    return program.addOwnership(std::move(init));
+}
+
+static bool isZeroElement(const llvm::Constant* elem) {
+    return elem->isNullValue() || llvm::isa<llvm::UndefValue>(elem);
+}
+
+/**
+ * @brief createAggregateInitializer Creates initializer of aggregate constant @C with @numElements elements.
+ * If most of the elements are zero (or undef), only the non-zero ones are initialized
+ * using designated initializer.
+ */
+static Expr* createAggregateInitializer(const llvm::Constant* C, unsigned numElements, Program& program) {
+    unsigned nonZero = 0;
+    for (unsigned i = 0; i < numElements; ++i) {
+        if (!isZeroElement(C->getAggregateElement(i))) {
+            ++nonZero;
+        }
+    }
+
+    if (nonZero == 0) {
+        return createZeroInitializer(C->getType(), program);
+    }
+
+    // vectors cannot be initialized by designators
+    bool designated = nonZero * 2 < numElements && !C->getType()->isVectorTy();
+    std::vector<Expr*> values;
+    std::vector<unsigned> indices;
+
+    for (unsigned i = 0; i < numElements; ++i) {
+        auto* elem = C->getAggregateElement(i);
+        if (designated && isZeroElement(elem)) {
+            continue;
+        }
+
+        values.push_back(createConstantValue(elem, program));
+        if (designated) {
+            indices.push_back(i);
+        }
+    }
+
+    auto ai = std::make_unique<AggregateInitializer>(std::move(values), std::move(indices));
+    ai->setType(program.getType(C->getType()));
+    return program.addOwnership(std::move(ai));
+}
+
+/**
+ * @brief isRawDataWritable Returns whether the elements of @CDS can be written directly from its raw data.
+ * Infinities and NaNs need special handling, so they are created as separate expressions.
+ */
+static bool isRawDataWritable(const llvm::ConstantDataSequential* CDS) {
+    const auto* elemTy = CDS->getElementType();
+    if (elemTy->isIntegerTy()) {
+        return true;
+    }
+
+    if (!elemTy->isFloatTy() && !elemTy->isDoubleTy()) {
+        return false;
+    }
+
+    for (unsigned i = 0; i < CDS->getNumElements(); ++i) {
+        if (!CDS->getElementAsAPFloat(i).isFinite()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 Expr* createUndefValue(const llvm::Type* ty, Program& program) {
     if (ty->isPointerTy()) {
         return program.makeExpr<Value>("0", program.getType(ty));
@@ -13,25 +89,12 @@ Expr* createUndefValue(const llvm::Type* ty, Program& program) {
         return program.addOwnership(std::move(zero));
     }
 
-    std::vector<Expr*> values;
-
-    if (auto* ST = llvm::dyn_cast_or_null<llvm::ArrayType>(ty)) {
-        for (auto i = 0; i < ST->getNumElements(); ++i) {
-            values.push_back(createUndefValue(ST->getElementType(), program));
-        }
-
-    } else if (auto* ST = llvm::dyn_cast_or_null<llvm::StructType>(ty)) {
-        for (auto i = 0; i < ST->getNumElements(); ++i) {
-            values.push_back(createUndefValue(ST->getElementType(i), program));
-        }
-    } else {
+    if (!ty->isArrayTy() && !ty->isStructTy() && !ty->isVectorTy()) {
         ty->print(llvm::errs(), true);
         assert(false && "globalVars: unrecognized type of undef value");
     }
 
-    auto init = std::make_unique<AggregateInitializer>(values);
-    init->setType(program.getType(ty));
-    return program.addOwnership(std::move(init));
+    return createZeroInitializer(ty, program);
 }
 
 Expr* createConstantValue(const llvm::Value* val, Program& program) {
@@ -115,48 +178,20 @@ Expr* createConstantValue(const llvm::Value* val, Program& program) {
         }
     }
 
-    if (const auto* CAZ = llvm::dyn_cast_or_null<llvm::ConstantAggregateZero>(val)) {
-        std::vector<Expr*> values;
-
-        for (int i = 0; i < CAZ->getNumElements(); ++i) {
-            auto* elem = CAZ->getElementValue(i);
-            values.push_back(createConstantValue(elem, program));
-        }
-
-        auto ai = std::make_unique<AggregateInitializer>(std::move(values));
-        ai->setType(program.getType(val->getType()));
-
-        return program.addOwnership(std::move(ai));
+    if (llvm::isa<llvm::ConstantAggregateZero>(val)) {
+        return createZeroInitializer(val->getType(), program);
     }
 
     if (const llvm::ConstantAggregate* CA = llvm::dyn_cast_or_null<llvm::ConstantAggregate>(val)) {
-        std::vector<Expr*> values;
-
-        for (int i = 0; true; ++i) {
-            auto* elem = CA->getAggregateElement(i);
-            if (!elem)
-                break;
-
-            values.push_back(createConstantValue(elem, program));
-        }
-
-        auto ai = std::make_unique<AggregateInitializer>(std::move(values));
-        ai->setType(program.getType(val->getType()));
-
-        return program.addOwnership(std::move(ai));
+        return createAggregateInitializer(CA, CA->getNumOperands(), program);
     }
 
     if (const llvm::ConstantDataSequential* CDS = llvm::dyn_cast_or_null<llvm::ConstantDataSequential>(val)) {
-        std::vector<Expr*> values;
-
-        for (int i = 0; i < CDS->getNumElements(); ++i) {
-            values.push_back(createConstantValue(CDS->getElementAsConstant(i), program));
+        if (isRawDataWritable(CDS)) {
+            return program.makeExpr<DataInitializer>(CDS->getRawDataValues(), CDS->getElementByteSize(), CDS->getElementType()->isFloatingPointTy(), program.getType(CDS->getType()));
         }
 
-        auto ai = std::make_unique<AggregateInitializer>(values);
-        ai->setType(program.getType(val->getType()));
-
-        return program.addOwnership(std::move(ai));
+        return createAggregateInitializer(CDS, CDS->getNumElements(), program);
     }
 
     if (auto *CE = const_cast<llvm::ConstantExpr*>(llvm::dyn_cast_or_null<llvm::ConstantExpr>(val))) {
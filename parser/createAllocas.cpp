@@ -7,6 +7,7 @@ void createAllocas(const llvm::Module* module, Program& program) {
     assert(program.isPassCompleted(PassType::CreateBlocks));
 
     for (const auto& function : module->functions()) {
+        FunctionScope functionScope(program, function);
         auto* func = program.getFunction(&function);
         for (const auto& block : function) {
             auto* myBlock = func->getBlock(&block);
@@ -17,6 +18,9 @@ void createAllocas(const llvm::Module* module, Program& program) {
                     const auto allocaInst = llvm::cast<const llvm::AllocaInst>(&ins);
 
                     auto theVariable = std::make_unique<Value>(func->getVarName(), func->getType(allocaInst->getAllocatedType()));
+                    if (allocaInst->getAlign().value() > TypeHandler::variableAlignment(module->getDataLayout(), allocaInst->getAllocatedType())) {
+                        theVariable->alignment = allocaInst->getAlign().value();
+                    }
                     auto alloc = std::make_unique<StackAlloc>(theVariable.get());
 
                     func->createExpr(&ins, std::make_unique<RefExpr>(theVariable.get(), program.typeHandler.pointerTo(theVariable.get()->getType())));
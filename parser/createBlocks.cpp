@@ -7,6 +7,7 @@ void createBlocks(const llvm::Module* module, Program& program) {
     assert(program.isPassCompleted(PassType::CreateFunctions));
 
     for (const llvm::Function& func : module->functions()) {
+        FunctionScope functionScope(program, func);
         if (func.size() == 0)
             continue;
 
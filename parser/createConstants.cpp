@@ -3,25 +3,47 @@
 #include "../core/Program.h"
 #include "constval.h"
 
-static void createConstantsForOperands(const llvm::User* ins, Program& program) {
-    for (const auto& op : ins->operands()) {
+#include <unordered_set>
+#include <vector>
 
-        // assumption: the GV that is an operand of this has already been initialized
-        // reason: pass ComputeGlobalVarsOrder has been completed
-        if (auto GV = llvm::dyn_cast_or_null<llvm::GlobalVariable>(op.get())) {
+/**
+ * Materializes every constant reachable from the operands of @user exactly once.
+ * Constants are visited in post-order with an explicit stack, because
+ * createConstantValue expects the operands of a ConstantExpr to be already present in exprMap.
+ */
+static void createConstantsForOperands(const llvm::User* user, Program& program, std::unordered_set<const llvm::Value*>& visited) {
+    // pair of constant being processed and index of its next operand
+    std::vector<std::pair<const llvm::User*, unsigned>> worklist;
+    worklist.emplace_back(user, 0);
+
+    while (!worklist.empty()) {
+        const llvm::User* current = worklist.back().first;
+        unsigned idx = worklist.back().second;
+
+        if (idx == current->getNumOperands()) {
+            worklist.pop_back();
+
+            // @user itself is an instruction or an initializer handled by initializeGlobalVars
+            if (current != user && program.getExpr(current) == nullptr) {
+                program.addExpr(current, createConstantValue(current, program));
+            }
             continue;
         }
 
-        if (auto *user = llvm::dyn_cast_or_null<llvm::User>(op.get())) {
-            if (!llvm::isa<llvm::Instruction>(user))
-                createConstantsForOperands(user, program);
+        worklist.back().second++;
+        const llvm::Value* op = current->getOperand(idx);
+
+        // assumption: the GV that is an operand of this has already been initialized
+        // reason: pass ComputeGlobalVarsOrder has been completed
+        if (llvm::isa<llvm::GlobalVariable>(op)) {
+            continue;
         }
 
-        if (auto C = llvm::dyn_cast_or_null<llvm::Constant>(op.get())) {
-            if (program.getExpr(op.get()) == nullptr)
-                program.addExpr(op.get(), createConstantValue(C, program));
+        if (!llvm::isa<llvm::Constant>(op) || !visited.insert(op).second) {
+            continue;
         }
 
+        worklist.emplace_back(llvm::cast<llvm::Constant>(op), 0);
     }
 }
 
@@ -30,19 +52,23 @@ void createConstants(const llvm::Module* mod, Program& program) {
     assert(program.isPassCompleted(PassType::ComputeGlobalVarsOrder));
     assert(program.isPassCompleted(PassType::CreateFunctions));
 
+    // constants shared by several instructions or initializers are materialized only once
+    std::unordered_set<const llvm::Value*> visited;
+
     for (const auto& gvar : mod->globals()) {
         if (gvar.hasInitializer()) {
             auto* init = gvar.getInitializer();
             if (auto *user = llvm::dyn_cast_or_null<llvm::User>(init)) {
-                createConstantsForOperands(user, program);
+                createConstantsForOperands(user, program, visited);
             }
         }
     }
 
     for (const auto& func : mod->functions()) {
+        FunctionScope functionScope(program, func);
         for (const auto& bb : func) {
             for (const auto& ins : bb) {
-                createConstantsForOperands(&ins, program);
+                createConstantsForOperands(&ins, program, visited);
             }
         }
     }
@@ -4,13 +4,19 @@
 #include "constval.h"
 #include "cfunc.h"
 #include "compare.h"
+#include "branchWeights.h"
+#include "intrinsics.h"
 
 #include <llvm/IR/Instruction.h>
 #include <llvm/IR/Instructions.h>
 #include <llvm/IR/IntrinsicInst.h>
 #include <llvm/Support/Casting.h>
 #include <llvm/IR/GetElementPtrTypeIterator.h>
+#include <llvm/IR/Operator.h>
+#include <algorithm>
+#include <numeric>
 #include <unordered_set>
+#include <limits>
 
 
 static std::unordered_set<int> read_only = {
@@ -49,57 +55,159 @@ static std::unordered_set<int> read_only = {
     llvm::Instruction::BitCast,
     llvm::Instruction::GetElementPtr,
     llvm::Instruction::ExtractValue,
+    llvm::Instruction::ExtractElement,
+    llvm::Instruction::InsertElement,
+    llvm::Instruction::ShuffleVector,
     llvm::Instruction::PHI,
 };
 
 Expr* parseLLVMInstruction(const llvm::Instruction& ins, Program& program);
 static void parseInlineASM(const llvm::Instruction& ins, Func* func, Block* block);
 
-const llvm::Instruction *getNextNonDebugInstruction(const llvm::Instruction *ins) {
-#if LLVM_VERSION_MAJOR > 6
-    return ins->getNextNonDebugInstruction();
-#else
-    // copied from LLVM sources, adapted
-    for (auto I = ins->getNextNode(); I; I = I->getNextNode())
-        if (!llvm::isa<llvm::DbgInfoIntrinsic>(I))
-          return I;
-    return nullptr;
-#endif // LLVM_VERSION_MAJOR > 6
+/**
+ * @brief Position of an instruction in its block and position of the first following instruction
+ * that is not read-only. Debug intrinsics are not counted.
+ */
+struct InstructionPosition {
+    unsigned position;
+    unsigned barrier;
+};
+
+using BlockPositions = llvm::DenseMap<const llvm::Instruction*, InstructionPosition>;
+
+/**
+ * @brief computeBlockPositions Computes positions of all instructions of @block in one backward sweep,
+ * so that canInline does not have to scan the block for every instruction.
+ */
+static void computeBlockPositions(const llvm::BasicBlock& block, BlockPositions& positions) {
+    std::vector<const llvm::Instruction*> instructions;
+    for (const auto& ins : block) {
+        if (!llvm::isa<llvm::DbgInfoIntrinsic>(ins)) {
+            instructions.push_back(&ins);
+        }
+    }
+
+    positions.clear();
+    unsigned barrier = std::numeric_limits<unsigned>::max();
+    for (unsigned i = instructions.size(); i-- > 0;) {
+        positions[instructions[i]] = { i, barrier };
+        // atomic loads order the surrounding memory accesses
+        if (read_only.find(instructions[i]->getOpcode()) == read_only.end() || instructions[i]->isAtomic()) {
+            barrier = i;
+        }
+    }
 }
 
-static bool canInline(const llvm::Value* value) {
-    if (llvm::isa<llvm::Constant>(value)) {
+/**
+ * @brief Returns the predicate that is equal to the given one when no operand is NaN.
+ */
+static llvm::CmpInst::Predicate withoutNaNs(llvm::CmpInst::Predicate predicate) {
+    switch (predicate) {
+    case llvm::CmpInst::FCMP_ORD:
+        return llvm::CmpInst::FCMP_TRUE;
+    case llvm::CmpInst::FCMP_UNO:
+        return llvm::CmpInst::FCMP_FALSE;
+    case llvm::CmpInst::FCMP_UEQ:
+        return llvm::CmpInst::FCMP_OEQ;
+    case llvm::CmpInst::FCMP_UNE:
+        return llvm::CmpInst::FCMP_ONE;
+    case llvm::CmpInst::FCMP_UGT:
+        return llvm::CmpInst::FCMP_OGT;
+    case llvm::CmpInst::FCMP_UGE:
+        return llvm::CmpInst::FCMP_OGE;
+    case llvm::CmpInst::FCMP_ULT:
+        return llvm::CmpInst::FCMP_OLT;
+    case llvm::CmpInst::FCMP_ULE:
+        return llvm::CmpInst::FCMP_OLE;
+    default:
+        return predicate;
+    }
+}
+
+/**
+ * @brief needsCompareExchangeLoop Returns true if the atomicrmw has no __atomic builtin and is written as a loop of compare and exchange.
+ */
+static bool needsCompareExchangeLoop(const llvm::AtomicRMWInst* RMW) {
+    switch (RMW->getOperation()) {
+    case llvm::AtomicRMWInst::Xchg:
+        return !RMW->getValOperand()->getType()->isIntOrPtrTy();
+    case llvm::AtomicRMWInst::Add:
+    case llvm::AtomicRMWInst::Sub:
+    case llvm::AtomicRMWInst::And:
+    case llvm::AtomicRMWInst::Nand:
+    case llvm::AtomicRMWInst::Or:
+    case llvm::AtomicRMWInst::Xor:
+        return false;
+    default:
         return true;
     }
+}
 
-    if (const auto* ins = llvm::dyn_cast_or_null<llvm::Instruction>(value)) {
-        if (ins->hasNUses(1)) {
-            const auto user = *ins->user_begin();
+/**
+ * @brief isUsedRepeatedly Returns true if the expression of @ins is written more than once in the expression of @user.
+ */
+static bool isUsedRepeatedly(const llvm::Instruction* ins, const llvm::Instruction* user) {
+    // the condition of a vector select is used in both halves of the blend
+    if (const auto* SI = llvm::dyn_cast<llvm::SelectInst>(user)) {
+        return SI->getCondition() == ins && ins->getType()->isVectorTy();
+    }
 
-            auto cur = getNextNonDebugInstruction(ins);
-            while (cur) {
-                if (cur == user) {
-                    return true;
-                }
+    if (const auto* intrinsic = llvm::dyn_cast<llvm::IntrinsicInst>(user)) {
+        return repeatsOperands(*intrinsic);
+    }
 
-                if (read_only.find(cur->getOpcode()) == read_only.end()) {
-                    return false;
-                }
+    // the loop of compare and exchange evaluates the operands in every iteration
+    if (const auto* RMW = llvm::dyn_cast<llvm::AtomicRMWInst>(user)) {
+        return needsCompareExchangeLoop(RMW);
+    }
+
+    // ORD and UNO compare every operand with itself, ONE and UEQ compare the operands twice
+    if (const auto* FC = llvm::dyn_cast<llvm::FCmpInst>(user)) {
+        auto predicate = FC->hasNoNaNs() ? withoutNaNs(FC->getPredicate()) : FC->getPredicate();
+        return predicate == llvm::CmpInst::FCMP_ORD || predicate == llvm::CmpInst::FCMP_UNO ||
+               predicate == llvm::CmpInst::FCMP_ONE || predicate == llvm::CmpInst::FCMP_UEQ;
+    }
+
+    return false;
+}
+
+/**
+ * @brief canInline Returns true if @value can be used directly in its only user, i.e. the user follows it
+ * in the same block and every instruction between them is read-only.
+ */
+static bool canInline(const llvm::Value* value, const BlockPositions& positions) {
+    if (llvm::isa<llvm::Constant>(value)) {
+        return true;
+    }
 
-                cur = getNextNonDebugInstruction(cur);
+    if (const auto* ins = llvm::dyn_cast_or_null<llvm::Instruction>(value)) {
+        // atomic operations must stay in their place
+        if (ins->hasNUses(1) && !ins->isAtomic()) {
+            const auto* user = llvm::dyn_cast<llvm::Instruction>(*ins->user_begin());
+            auto insPos = positions.find(ins);
+            auto userPos = user ? positions.find(user) : positions.end();
+
+            // the user is not in the same block
+            if (insPos == positions.end() || userPos == positions.end() || isUsedRepeatedly(ins, user)) {
+                return false;
             }
+
+            return insPos->second.position < userPos->second.position && userPos->second.position <= insPos->second.barrier;
         }
     }
 
     return false;
 }
 
-static void inlineOrCreateVariable(const llvm::Value* value, Expr* expr, Func* func, Block* block) {
-    if (canInline(value)) {
+static void inlineOrCreateVariable(const llvm::Value* value, Expr* expr, Func* func, Block* block, const BlockPositions& positions) {
+    if (canInline(value, positions)) {
         func->program->addExpr(value, expr);
+        func->program->stats.inlinedExprs++;
         return;
     }
 
+    func->program->stats.materializedExprs++;
+
     auto var = std::make_unique<Value>(func->getVarName(), expr->getType());
     auto assign = std::make_unique<AssignExpr>(var.get(), expr);
     auto alloca = std::make_unique<StackAlloc>(var.get());
@@ -157,86 +265,302 @@ static Expr* parseExtractValueInstruction(const llvm::Instruction& ins, Program&
     return program.makeExpr<ExtractValueExpr>(std::move(indices));
 }
 
-static std::unique_ptr<Expr> buildIsNan(Program& program, Expr* val) {
-    if (val->getType() == program.typeHandler.floatType.get())
-        return std::make_unique<CallExpr>(nullptr, "__isnanf", std::vector<Expr*>{val}, program.typeHandler.sint.get());
-    return std::make_unique<CallExpr>(nullptr, "__isnan", std::vector<Expr*>{val}, program.typeHandler.sint.get());
+/**
+ * @brief integerVectorOf Returns vector of integers with the same number and size of elements as @type.
+ */
+static VectorType* integerVectorOf(const VectorType* type, bool isUnsigned, Program& program) {
+    return program.typeHandler.vectorOf(program.typeHandler.integerOfSize(type->elementSize, isUnsigned), type->size);
+}
+
+/**
+ * @brief castVector Reinterprets bits of vector @expr as vector @type, GCC does not convert vectors implicitly.
+ */
+static Expr* castVector(Expr* expr, VectorType* type, Program& program) {
+    if (expr->getType() == type) {
+        return expr;
+    }
 
+    return program.makeExpr<CastExpr>(expr, type);
 }
 
-static Expr* parseFCmpInstruction(const llvm::Instruction& ins, Program& program) {
-    static std::unordered_set<llvm::CmpInst::Predicate> validPredicates = {
-        llvm::CmpInst::ICMP_EQ,
-        llvm::CmpInst::FCMP_OEQ,
-        llvm::CmpInst::FCMP_UEQ,
-        llvm::CmpInst::ICMP_NE,
-        llvm::CmpInst::FCMP_ONE,
-        llvm::CmpInst::FCMP_UNE,
-        llvm::CmpInst::ICMP_UGT,
-        llvm::CmpInst::ICMP_SGT,
-        llvm::CmpInst::FCMP_UGT,
-        llvm::CmpInst::FCMP_OGT,
-        llvm::CmpInst::ICMP_UGE,
-        llvm::CmpInst::ICMP_SGE,
-        llvm::CmpInst::FCMP_OGE,
-        llvm::CmpInst::FCMP_UGE,
-        llvm::CmpInst::ICMP_ULT,
-        llvm::CmpInst::ICMP_SLT,
-        llvm::CmpInst::FCMP_OLT,
-        llvm::CmpInst::FCMP_ULT,
-        llvm::CmpInst::ICMP_ULE,
-        llvm::CmpInst::ICMP_SLE,
-        llvm::CmpInst::FCMP_OLE,
-        llvm::CmpInst::FCMP_ULE,
+/**
+ * @brief convertVector Converts every element of vector @expr to the element type of @type.
+ * Integers of the same size are only reinterpreted.
+ */
+static Expr* convertVector(Expr* expr, VectorType* type, Program& program) {
+    const auto* VT = llvm::cast<VectorType>(expr->getType());
+    if (llvm::isa<IntegerType>(VT->elementType) && llvm::isa<IntegerType>(type->elementType) && VT->elementSize == type->elementSize) {
+        return castVector(expr, type, program);
+    }
+
+    auto* typeName = program.makeExpr<Value>(type->toString(), type);
+    return program.makeExpr<CallExpr>(nullptr, "__builtin_convertvector", std::vector<Expr*>{ expr, typeName }, type);
+}
+
+static Expr* parseExtractElementInstruction(const llvm::Instruction& ins, Program& program) {
+    Expr* vector = program.getExpr(ins.getOperand(0));
+    Expr* index = program.getExpr(ins.getOperand(1));
+    assert(vector && index);
+
+    return program.makeExpr<ArrayElement>(vector, index, program.getType(ins.getType()));
+}
+
+/**
+ * @brief Parses insertelement instruction. Element inserted into undef vector is written as compound literal
+ * (vectors cannot be initialized by designators), otherwise the element is shuffled into the vector by __builtin_shufflevector.
+ */
+static Expr* parseInsertElementInstruction(const llvm::Instruction& ins, Program& program) {
+    auto* type = llvm::cast<VectorType>(program.getType(ins.getType()));
+    Expr* element = program.getExpr(ins.getOperand(1));
+    assert(element);
+
+    const auto* index = llvm::dyn_cast<llvm::ConstantInt>(ins.getOperand(2));
+    if (!index) {
+        throw std::invalid_argument("insertelement with non-constant index is not supported!");
+    }
+
+    unsigned position = index->getZExtValue();
+    if (llvm::isa<llvm::UndefValue>(ins.getOperand(0))) {
+        std::vector<Expr*> values(position, program.makeExpr<Value>("0", type->elementType));
+        values.push_back(element);
+
+        auto* inserted = program.makeExpr<AggregateInitializer>(values);
+        inserted->setType(type);
+        return inserted;
+    }
+
+    Expr* vector = program.getExpr(ins.getOperand(0));
+    assert(vector);
+
+    auto* inserted = program.makeExpr<AggregateInitializer>(std::vector<Expr*>{ element });
+    inserted->setType(type);
+
+    std::vector<Expr*> params{ vector, inserted };
+    for (unsigned i = 0; i < type->size; i++) {
+        unsigned source = i == position ? type->size : i;
+        params.push_back(program.makeExpr<Value>(std::to_string(source), program.typeHandler.sint.get()));
+    }
+
+    return program.makeExpr<CallExpr>(nullptr, "__builtin_shufflevector", params, type);
+}
+
+/**
+ * @brief Parses shufflevector instruction. Splat of a variable or a constant is written as compound literal
+ * with the value repeated, other shuffles use __builtin_shufflevector. Undefined elements of the mask are replaced by 0.
+ */
+static Expr* parseShuffleVectorInstruction(const llvm::Instruction& ins, Program& program) {
+    const auto* SVI = llvm::cast<llvm::ShuffleVectorInst>(&ins);
+    auto* type = llvm::cast<VectorType>(program.getType(SVI->getType()));
+
+    const auto* insert = llvm::dyn_cast<llvm::InsertElementInst>(SVI->getOperand(0));
+    if (insert && llvm::isa<llvm::UndefValue>(insert->getOperand(0)) && SVI->isZeroEltSplat()) {
+        const auto* index = llvm::dyn_cast<llvm::ConstantInt>(insert->getOperand(2));
+        Expr* element = program.getExpr(insert->getOperand(1));
+
+        if (index && index->isZero() && llvm::isa<Value>(element)) {
+            auto* splat = program.makeExpr<AggregateInitializer>(std::vector<Expr*>(type->size, element));
+            splat->setType(type);
+            return splat;
+        }
+    }
+
+    Expr* val0 = program.getExpr(SVI->getOperand(0));
+    Expr* val1 = program.getExpr(SVI->getOperand(1));
+    assert(val0 && val1);
+
+    std::vector<Expr*> params{ val0, val1 };
+    for (int index : SVI->getShuffleMask()) {
+        params.push_back(program.makeExpr<Value>(std::to_string(std::max(index, 0)), program.typeHandler.sint.get()));
+    }
+
+    return program.makeExpr<CallExpr>(nullptr, "__builtin_shufflevector", params, type);
+}
+
+/**
+ * @brief Returns whether the operand is a floating point constant other than NaN.
+ */
+static bool isNotNaN(const llvm::Value* operand) {
+    const auto* constant = llvm::dyn_cast<llvm::ConstantFP>(operand);
+    return constant && !constant->isNaN();
+}
+
+/**
+ * @brief Builds expression that is true iff none of the operands is NaN (x == x is false only for NaN).
+ */
+static Expr* buildIsOrdered(const llvm::Instruction& ins, Program& program) {
+    std::vector<Expr*> checks;
+    for (unsigned i = 0; i < 2; i++) {
+        const llvm::Value* operand = ins.getOperand(i);
+        if (isNotNaN(operand) || (i == 1 && operand == ins.getOperand(0)))
+            continue;
+
+        Expr* val = program.getExpr(operand);
+        checks.push_back(program.makeExpr<CmpExpr>(val, val, "==", false));
+    }
+
+    if (checks.empty())
+        return program.makeExpr<Value>("1", program.typeHandler.sint.get());
+    if (checks.size() == 1)
+        return checks[0];
+    return program.makeExpr<LogicalAnd>(checks[0], checks[1]);
+}
+
+/**
+ * @brief Parses ICmp and FCmp instructions on vectors. GCC compares vectors element-wise and returns -1 for true
+ * elements, so the result is negated (or incremented for negated predicates) and converted to the vector
+ * of 0 and 1 representing <N x i1>. Predicates are split to comparisons in the same way as in parseFCmpInstruction.
+ */
+static Expr* parseVectorCmpInstruction(const llvm::Instruction& ins, Program& program) {
+    auto cmpInst = llvm::cast<const llvm::CmpInst>(&ins);
+    auto* type = llvm::cast<VectorType>(program.getType(ins.getType()));
+    auto* operandType = llvm::cast<VectorType>(program.getType(ins.getOperand(0)->getType()));
+    auto* maskType = integerVectorOf(operandType, false, program);
+
+    Expr* val0 = program.getExpr(ins.getOperand(0));
+    Expr* val1 = program.getExpr(ins.getOperand(1));
+    assert(val0 && val1);
+
+    if (cmpInst->isIntPredicate()) {
+        auto* compared = integerVectorOf(operandType, isIntegerCompareUnsigned(cmpInst), program);
+        val0 = castVector(val0, compared, program);
+        val1 = castVector(val1, compared, program);
+    }
+
+    auto compare = [&](Expr* left, Expr* right, const std::string& comparsion) -> Expr* {
+        auto* cmp = program.makeExpr<CmpExpr>(left, right, comparsion, false);
+        cmp->setType(maskType);
+        return cmp;
     };
 
+    auto predicate = cmpInst->getPredicate();
+    if (cmpInst->isFPPredicate() && cmpInst->hasNoNaNs()) {
+        predicate = withoutNaNs(predicate);
+    }
+
+    Expr* mask = nullptr;
+    bool negated = false;
+    switch (predicate) {
+    case llvm::CmpInst::FCMP_FALSE:
+    case llvm::CmpInst::FCMP_TRUE: {
+        auto* value = program.makeExpr<Value>(predicate == llvm::CmpInst::FCMP_TRUE ? "1" : "0", type->elementType);
+        auto* result = program.makeExpr<AggregateInitializer>(std::vector<Expr*>(type->size, value));
+        result->setType(type);
+        return result;
+    }
+
+    case llvm::CmpInst::FCMP_ORD:
+    case llvm::CmpInst::FCMP_UNO:
+        mask = compare(val0, val0, "==");
+        if (ins.getOperand(0) != ins.getOperand(1)) {
+            mask = program.makeExpr<AndExpr>(mask, compare(val1, val1, "=="));
+        }
+        negated = predicate == llvm::CmpInst::FCMP_UNO;
+        break;
+
+    case llvm::CmpInst::FCMP_ONE:
+    case llvm::CmpInst::FCMP_UEQ:
+        mask = program.makeExpr<OrExpr>(compare(val0, val1, "<"), compare(val0, val1, ">"));
+        negated = predicate == llvm::CmpInst::FCMP_UEQ;
+        break;
+
+    case llvm::CmpInst::FCMP_UGT:
+    case llvm::CmpInst::FCMP_UGE:
+    case llvm::CmpInst::FCMP_ULT:
+    case llvm::CmpInst::FCMP_ULE:
+        mask = compare(val0, val1, getComparePredicate(llvm::CmpInst::getInversePredicate(predicate)));
+        negated = true;
+        break;
+
+    default:
+        mask = compare(val0, val1, getComparePredicate(predicate));
+    }
+
+    Expr* result = nullptr;
+    if (negated) {
+        result = program.makeExpr<AddExpr>(mask, program.makeExpr<Value>("1", program.typeHandler.sint.get()), false);
+    } else {
+        result = program.makeExpr<MinusExpr>(mask);
+    }
+
+    return convertVector(result, type, program);
+}
+
+/**
+ * @brief Parses FCmp instruction. C relational operators are false when an operand
+ * is NaN and != is true, so they match the ordered predicates and UNE exactly.
+ * The other unordered predicates are negations of the inverse ordered ones and only
+ * ONE, UEQ, ORD and UNO need more than one comparison. With the nnan flag unordered
+ * predicates are replaced by the ordered ones.
+ */
+static Expr* parseFCmpInstruction(const llvm::Instruction& ins, Program& program) {
+    if (ins.getType()->isVectorTy()) {
+        return parseVectorCmpInstruction(ins, program);
+    }
+
     Expr* val0 = program.getExpr(ins.getOperand(0));
     Expr* val1 = program.getExpr(ins.getOperand(1));
     assert(val0 && val1);
 
     auto cmpInst = llvm::cast<const llvm::CmpInst>(&ins);
-    auto isNan0 = program.addOwnership(buildIsNan(program, val0));
-    auto isNan1 = program.addOwnership(buildIsNan(program, val1));
-    auto isOrderedExpr0 = program.makeExpr<LogicalNot>(isNan0);
-    auto isOrderedExpr1 = program.makeExpr<LogicalNot>(isNan1);
-    Expr* isAllOrdered = program.makeExpr<LogicalAnd>(isOrderedExpr0, isOrderedExpr1);
+    assert(llvm::CmpInst::isFPPredicate(cmpInst->getPredicate()) && "expressions: parseFCmpInstruction received a CmpInst with non-FP predicate");
 
-    // include CMath, because we need it for checking isNan
-    program.hasCMath = true;
+    auto predicate = cmpInst->getPredicate();
+    if (cmpInst->hasNoNaNs()) {
+        predicate = withoutNaNs(predicate);
+    }
 
-    assert(llvm::CmpInst::isFPPredicate(cmpInst->getPredicate()) && "expressions: parseFCmpInstruction received a CmpInst with non-FP predicate");
-    switch(cmpInst->getPredicate()) {
+    switch (predicate) {
     case llvm::CmpInst::FCMP_FALSE:
         return program.makeExpr<Value>("0", program.typeHandler.sint.get());
     case llvm::CmpInst::FCMP_TRUE:
         return program.makeExpr<Value>("1", program.typeHandler.sint.get());
 
     case llvm::CmpInst::FCMP_ORD:
-        return isAllOrdered;
+        return buildIsOrdered(ins, program);
     case llvm::CmpInst::FCMP_UNO:
-        return program.makeExpr<LogicalNot>(isAllOrdered);
-    default:
-        // just make sure it is one of comparison operators. otherwise, it is unhandled by llvm2c
-        assert(validPredicates.find(cmpInst->getPredicate()) != validPredicates.end());
-        break;
+        return program.makeExpr<LogicalNot>(buildIsOrdered(ins, program));
+
+    case llvm::CmpInst::FCMP_OEQ:
+    case llvm::CmpInst::FCMP_OGT:
+    case llvm::CmpInst::FCMP_OGE:
+    case llvm::CmpInst::FCMP_OLT:
+    case llvm::CmpInst::FCMP_OLE:
+    case llvm::CmpInst::FCMP_UNE:
+        return program.makeExpr<CmpExpr>(val0, val1, getComparePredicate(predicate), false);
+
+    case llvm::CmpInst::FCMP_ONE:
+    case llvm::CmpInst::FCMP_UEQ: {
+        // a != b is true also for NaN operands, (a < b || a > b) is not
+        if (cmpInst->hasNoNaNs() || (isNotNaN(ins.getOperand(0)) && isNotNaN(ins.getOperand(1)))) {
+            return program.makeExpr<CmpExpr>(val0, val1, predicate == llvm::CmpInst::FCMP_ONE ? "!=" : "==", false);
+        }
+        auto less = program.makeExpr<CmpExpr>(val0, val1, "<", false);
+        auto greater = program.makeExpr<CmpExpr>(val0, val1, ">", false);
+        Expr* notEqual = program.makeExpr<LogicalOr>(less, greater);
+        if (predicate == llvm::CmpInst::FCMP_ONE)
+            return notEqual;
+        return program.makeExpr<LogicalNot>(notEqual);
     }
-    std::string pred = getComparePredicate(cmpInst);
-
-    auto cmpExpr = program.makeExpr<CmpExpr>(val0, val1, pred, false);
 
-    if (llvm::CmpInst::isOrdered(cmpInst->getPredicate())) {
-        return program.makeExpr<LogicalAnd>(isAllOrdered, cmpExpr);
-    } else if (llvm::CmpInst::isUnordered(cmpInst->getPredicate())) {
-        auto isUnordered = program.makeExpr<LogicalNot>(isAllOrdered);
-        return program.makeExpr<LogicalOr>(isUnordered, cmpExpr);
+    case llvm::CmpInst::FCMP_UGT:
+    case llvm::CmpInst::FCMP_UGE:
+    case llvm::CmpInst::FCMP_ULT:
+    case llvm::CmpInst::FCMP_ULE: {
+        auto inverse = llvm::CmpInst::getInversePredicate(predicate);
+        auto cmpExpr = program.makeExpr<CmpExpr>(val0, val1, getComparePredicate(inverse), false);
+        return program.makeExpr<LogicalNot>(cmpExpr);
     }
 
-    cmpInst->print(llvm::errs(), true);
-    assert(false && "parseFCmpInstruction: unknown compare predicate");
-    abort(); // for release builds
+    default:
+        throw std::invalid_argument("parseFCmpInstruction: unknown compare predicate");
+    }
 }
 
 static Expr* parseICmpInstruction(const llvm::Instruction& ins, Program& program) {
+    if (ins.getType()->isVectorTy()) {
+        return parseVectorCmpInstruction(ins, program);
+    }
+
     Expr* val0 = program.getExpr(ins.getOperand(0));
     Expr* val1 = program.getExpr(ins.getOperand(1));
     assert(val0 && val1);
@@ -246,6 +570,234 @@ static Expr* parseICmpInstruction(const llvm::Instruction& ins, Program& program
     return program.makeExpr<CmpExpr>(val0, val1, getComparePredicate(cmpInst), isIntegerCompareUnsigned(cmpInst));
 }
 
+/**
+ * @brief createMemoryOrder Returns the memory order of __atomic builtins equal to the LLVM atomic ordering.
+ */
+static Expr* createMemoryOrder(llvm::AtomicOrdering ordering, Program& program) {
+    std::string order;
+    switch (ordering) {
+    case llvm::AtomicOrdering::Acquire:
+        order = "__ATOMIC_ACQUIRE";
+        break;
+    case llvm::AtomicOrdering::Release:
+        order = "__ATOMIC_RELEASE";
+        break;
+    case llvm::AtomicOrdering::AcquireRelease:
+        order = "__ATOMIC_ACQ_REL";
+        break;
+    case llvm::AtomicOrdering::SequentiallyConsistent:
+        order = "__ATOMIC_SEQ_CST";
+        break;
+    default:
+        order = "__ATOMIC_RELAXED";
+    }
+
+    return program.makeExpr<Value>(order, program.typeHandler.sint.get());
+}
+
+/**
+ * @brief checkAtomicType Throws if the atomic operation works on a type the __atomic_*_n builtins do not accept.
+ */
+static void checkAtomicType(const llvm::Instruction& ins, const llvm::Type* type) {
+    if (!type->isIntegerTy() && !type->isPointerTy()) {
+        throw std::invalid_argument(std::string("Atomic ") + ins.getOpcodeName() + " of non-integer type is not supported!");
+    }
+}
+
+static void parseFenceInstruction(const llvm::Instruction& ins, Func* func, Block* block) {
+    const auto* FI = llvm::cast<llvm::FenceInst>(&ins);
+
+    // fence in the same thread only orders accesses with respect to signal handlers
+    std::string name = FI->getSyncScopeID() == llvm::SyncScope::SingleThread ? "__atomic_signal_fence" : "__atomic_thread_fence";
+    std::vector<Expr*> params{ createMemoryOrder(FI->getOrdering(), *func->program) };
+
+    auto* fence = func->program->makeExpr<CallExpr>(nullptr, name, params, func->program->typeHandler.voidType.get());
+    func->program->addExpr(&ins, fence);
+    block->addExpr(fence);
+}
+
+/**
+ * @brief Parses atomicrmw without an __atomic builtin (min, max, fadd, fsub and xchg of floating-point values) as
+ *     old = *ptr; do { desired = op(old, value); } while (!compare_exchange(ptr, &old, &desired));
+ * The generic __atomic_load and __atomic_compare_exchange accept also floating-point values. The failed compare and exchange
+ * writes the current value to old, so old holds the value replaced by the successful exchange.
+ */
+static void parseCompareExchangeLoop(const llvm::AtomicRMWInst* RMW, Func* func, Block* block) {
+    auto& program = *func->program;
+    auto* type = func->getType(RMW->getType());
+
+    Expr* pointer = func->getExpr(RMW->getPointerOperand());
+    Expr* value = func->getExpr(RMW->getValOperand());
+    assert(pointer && value);
+
+    auto* old = program.makeExpr<Value>(func->getVarName(), type);
+    auto* desired = program.makeExpr<Value>(func->getVarName(), type);
+    block->addExpr(program.makeExpr<StackAlloc>(static_cast<Value*>(old)));
+    block->addExpr(program.makeExpr<StackAlloc>(static_cast<Value*>(desired)));
+
+    Expr* oldPointer = program.makeExpr<RefExpr>(old, program.typeHandler.pointerTo(type));
+    Expr* desiredPointer = program.makeExpr<RefExpr>(desired, program.typeHandler.pointerTo(type));
+
+    std::vector<Expr*> loadParams{ pointer, oldPointer, createMemoryOrder(llvm::AtomicOrdering::Monotonic, program) };
+    block->addExpr(program.makeExpr<CallExpr>(nullptr, "__atomic_load", loadParams, program.typeHandler.voidType.get()));
+
+    // the loop does not pass through addSignCasts, so the compared values are cast here
+    auto select = [&](const std::string& comparsion, bool isUnsigned) -> Expr* {
+        auto* IT = llvm::cast<IntegerType>(type);
+        auto* compared = isUnsigned ? program.typeHandler.setUnsigned(IT) : program.typeHandler.setSigned(IT);
+        auto* cmp = program.makeExpr<CmpExpr>(program.makeExpr<CastExpr>(old, compared), program.makeExpr<CastExpr>(value, compared), comparsion, isUnsigned);
+        return program.makeExpr<SelectExpr>(cmp, old, value);
+    };
+
+    Expr* result = nullptr;
+    switch (RMW->getOperation()) {
+    case llvm::AtomicRMWInst::Xchg:
+        result = value;
+        break;
+    case llvm::AtomicRMWInst::Max:
+        result = select(">", false);
+        break;
+    case llvm::AtomicRMWInst::Min:
+        result = select("<", false);
+        break;
+    case llvm::AtomicRMWInst::UMax:
+        result = select(">", true);
+        break;
+    case llvm::AtomicRMWInst::UMin:
+        result = select("<", true);
+        break;
+    case llvm::AtomicRMWInst::FAdd:
+        result = program.makeExpr<AddExpr>(old, value, true);
+        break;
+    case llvm::AtomicRMWInst::FSub:
+        result = program.makeExpr<SubExpr>(old, value, true);
+        break;
+    default:
+        throw std::invalid_argument("atomicrmw " + llvm::AtomicRMWInst::getOperationName(RMW->getOperation()).str() + " is not supported!");
+    }
+
+    auto failure = llvm::AtomicCmpXchgInst::getStrongestFailureOrdering(RMW->getOrdering());
+    std::vector<Expr*> exchangeParams{
+        pointer,
+        oldPointer,
+        desiredPointer,
+        program.makeExpr<Value>("0", program.typeHandler.sint.get()),
+        createMemoryOrder(RMW->getOrdering(), program),
+        createMemoryOrder(failure, program),
+    };
+    auto* exchange = program.makeExpr<CallExpr>(nullptr, "__atomic_compare_exchange", exchangeParams, program.typeHandler.sint.get());
+    auto* body = program.makeExpr<AssignExpr>(desired, result);
+    block->addExpr(program.makeExpr<DoWhile>(body, program.makeExpr<LogicalNot>(exchange)));
+
+    program.addExpr(RMW, old);
+}
+
+static void parseAtomicRMWInstruction(const llvm::Instruction& ins, Func* func, Block* block, const BlockPositions& positions) {
+    const auto* RMW = llvm::cast<llvm::AtomicRMWInst>(&ins);
+    if (needsCompareExchangeLoop(RMW)) {
+        parseCompareExchangeLoop(RMW, func, block);
+        return;
+    }
+
+    std::string name;
+    switch (RMW->getOperation()) {
+    case llvm::AtomicRMWInst::Xchg:
+        name = "__atomic_exchange_n";
+        break;
+    case llvm::AtomicRMWInst::Add:
+        name = "__atomic_fetch_add";
+        break;
+    case llvm::AtomicRMWInst::Sub:
+        name = "__atomic_fetch_sub";
+        break;
+    case llvm::AtomicRMWInst::And:
+        name = "__atomic_fetch_and";
+        break;
+    case llvm::AtomicRMWInst::Nand:
+        name = "__atomic_fetch_nand";
+        break;
+    case llvm::AtomicRMWInst::Or:
+        name = "__atomic_fetch_or";
+        break;
+    case llvm::AtomicRMWInst::Xor:
+        name = "__atomic_fetch_xor";
+        break;
+    default:
+        assert(false && "atomicrmw without __atomic builtin must use the loop");
+    }
+
+    Expr* pointer = func->getExpr(RMW->getPointerOperand());
+    Expr* value = func->getExpr(RMW->getValOperand());
+    assert(pointer && value);
+
+    std::vector<Expr*> params{ pointer, value, createMemoryOrder(RMW->getOrdering(), *func->program) };
+    auto* call = func->program->makeExpr<CallExpr>(nullptr, name, params, func->getType(ins.getType()));
+
+    if (ins.hasNUses(0)) {
+        func->program->addExpr(&ins, call);
+        block->addExpr(call);
+    } else {
+        inlineOrCreateVariable(&ins, call, func, block, positions);
+    }
+}
+
+/**
+ * @brief Parses cmpxchg. The compared value is stored to the first item of the resulting structure,
+ * where __atomic_compare_exchange_n writes the current value if the exchange fails, so it always holds the loaded value.
+ */
+static void parseCmpXchgInstruction(const llvm::Instruction& ins, Func* func, Block* block) {
+    const auto* CXI = llvm::cast<llvm::AtomicCmpXchgInst>(&ins);
+    checkAtomicType(ins, CXI->getCompareOperand()->getType());
+
+    auto& program = *func->program;
+    Expr* pointer = func->getExpr(CXI->getPointerOperand());
+    Expr* compared = func->getExpr(CXI->getCompareOperand());
+    Expr* replacement = func->getExpr(CXI->getNewValOperand());
+    assert(pointer && compared && replacement);
+
+    auto* var = program.makeExpr<Value>(func->getVarName(), func->getType(ins.getType()));
+    block->addExpr(program.makeExpr<StackAlloc>(static_cast<Value*>(var)));
+
+    auto* loaded = program.makeExpr<AggregateElement>(var, 0);
+    auto* success = program.makeExpr<AggregateElement>(var, 1);
+    block->addExpr(program.makeExpr<AssignExpr>(loaded, compared));
+
+    std::vector<Expr*> params{
+        pointer,
+        program.makeExpr<RefExpr>(loaded, program.typeHandler.pointerTo(loaded->getType())),
+        replacement,
+        program.makeExpr<Value>(CXI->isWeak() ? "1" : "0", program.typeHandler.sint.get()),
+        createMemoryOrder(CXI->getSuccessOrdering(), program),
+        createMemoryOrder(CXI->getFailureOrdering(), program),
+    };
+    auto* exchange = program.makeExpr<CallExpr>(nullptr, "__atomic_compare_exchange_n", params, success->getType());
+    block->addExpr(program.makeExpr<AssignExpr>(success, exchange));
+
+    program.addExpr(&ins, var);
+}
+
+/**
+ * @brief assumeAligned Wraps pointer of a load or store in __builtin_assume_aligned if the access is aligned more than
+ * the accessed type. Pointers into variables are kept, declarations of the variables already carry their alignment.
+ */
+static Expr* assumeAligned(Expr* pointer, const llvm::Value* llvmPointer, llvm::Type* accessed, llvm::Align align, const llvm::DataLayout& layout, Program& program) {
+    if (align.value() <= TypeHandler::naturalAlignment(layout, accessed)) {
+        return pointer;
+    }
+
+    const llvm::Value* object = llvmPointer;
+    while (llvm::isa<llvm::GEPOperator>(object) || llvm::isa<llvm::BitCastOperator>(object)) {
+        object = llvm::cast<llvm::Operator>(object)->getOperand(0);
+    }
+
+    if (llvm::isa<llvm::AllocaInst>(object) || llvm::isa<llvm::GlobalVariable>(object) || llvm::isa<llvm::ConstantPointerNull>(object)) {
+        return pointer;
+    }
+
+    std::vector<Expr*> params{ pointer, program.makeExpr<Value>(std::to_string(align.value()), program.typeHandler.ulong.get()) };
+    auto* call = program.makeExpr<CallExpr>(nullptr, "__builtin_assume_aligned", params, program.typeHandler.pointerTo(program.typeHandler.voidType.get()));
+    return program.makeExpr<CastExpr>(call, pointer->getType());
+}
 
 static Expr* parseStoreInstruction(const llvm::Instruction& ins, Program& program) {
     auto type = program.getType(ins.getOperand(0)->getType());
@@ -337,7 +889,14 @@ static Expr* parseStoreInstruction(const llvm::Instruction& ins, Program& progra
         program.addOwnership(std::move(newCast));
     }
 
-    auto deref = std::make_unique<DerefExpr>(val1);
+    const auto* SI = llvm::cast<llvm::StoreInst>(&ins);
+    if (SI->isAtomic()) {
+        checkAtomicType(ins, SI->getValueOperand()->getType());
+        std::vector<Expr*> params{ val1, val0, createMemoryOrder(SI->getOrdering(), program) };
+        return program.makeExpr<CallExpr>(nullptr, "__atomic_store_n", params, program.typeHandler.voidType.get());
+    }
+
+    auto deref = std::make_unique<DerefExpr>(assumeAligned(val1, SI->getPointerOperand(), SI->getValueOperand()->getType(), SI->getAlign(), ins.getModule()->getDataLayout(), program));
 
     //inline asm with single output
     if (auto AE = llvm::dyn_cast_or_null<AsmExpr>(val0)) {
@@ -353,7 +912,14 @@ static Expr* parseStoreInstruction(const llvm::Instruction& ins, Program& progra
 }
 
 static Expr* parseLoadInstruction(const llvm::Instruction& ins, Program& program) {
-    auto deref = std::make_unique<DerefExpr>(program.getExpr(ins.getOperand(0)));
+    const auto* LI = llvm::cast<llvm::LoadInst>(&ins);
+    if (LI->isAtomic()) {
+        checkAtomicType(ins, LI->getType());
+        std::vector<Expr*> params{ program.getExpr(LI->getPointerOperand()), createMemoryOrder(LI->getOrdering(), program) };
+        return program.makeExpr<CallExpr>(nullptr, "__atomic_load_n", params, program.getType(LI->getType()));
+    }
+
+    auto deref = std::make_unique<DerefExpr>(assumeAligned(program.getExpr(LI->getPointerOperand()), LI->getPointerOperand(), LI->getType(), LI->getAlign(), ins.getModule()->getDataLayout(), program));
     return program.addOwnership(std::move(deref));
 }
 
@@ -364,6 +930,14 @@ static Expr* parseBinaryInstruction(const llvm::Instruction& ins, Program& progr
     Expr* val1 = program.getExpr(ins.getOperand(1));
     assert(val0 && val1);
 
+    // vectors have unsigned elements, signed division needs the signed vector
+    auto* VT = llvm::dyn_cast<VectorType>(program.getType(ins.getType()));
+    bool isSignedVector = VT && ins.getType()->isIntOrIntVectorTy() && (ins.getOpcode() == llvm::Instruction::SDiv || ins.getOpcode() == llvm::Instruction::SRem);
+    if (isSignedVector) {
+        val0 = castVector(val0, integerVectorOf(VT, false, program), program);
+        val1 = castVector(val1, integerVectorOf(VT, false, program), program);
+    }
+
     std::unique_ptr<Expr> expr;
     switch (ins.getOpcode()) {
     case llvm::Instruction::Add:
@@ -406,6 +980,10 @@ static Expr* parseBinaryInstruction(const llvm::Instruction& ins, Program& progr
         throw std::invalid_argument("Unsupported binary instruction encountered!");
     }
 
+    if (isSignedVector) {
+        return castVector(program.addOwnership(std::move(expr)), VT, program);
+    }
+
     return program.addOwnership(std::move(expr));
 }
 
@@ -420,8 +998,12 @@ static Expr* createListOfOneGoto(Block* container, Block* gotoTarget) {
     return result;
 }
 
+/**
+ * @brief Parses switch instruction. Cases are written by decreasing branch weight if the switch has a profile
+ * (by increasing value otherwise) and the value of a case taken with high probability is passed to __builtin_expect.
+ */
 static void parseSwitchInstruction(const llvm::Instruction& ins, bool isConstExpr, const llvm::Value* val, Func* func, Block* block) {
-    std::map<int, Expr*> cases;
+    std::vector<std::pair<int, Expr*>> cases;
 
     Expr* cmp = func->getExpr(ins.getOperand(0));
     assert(cmp);
@@ -429,9 +1011,29 @@ static void parseSwitchInstruction(const llvm::Instruction& ins, bool isConstExp
     Block* def = func->createBlockIfNotExist(llvm::cast<llvm::BasicBlock>(ins.getOperand(1)));
     const llvm::SwitchInst* switchIns = llvm::cast<llvm::SwitchInst>(&ins);
 
-    for (auto& switchCase : switchIns->cases()) {
+    // weights[0] belongs to the default destination
+    auto weights = getBranchWeights(ins);
+    uint64_t total = std::accumulate(weights.begin(), weights.end(), (uint64_t)0);
+
+    std::vector<llvm::SwitchInst::ConstCaseHandle> switchCases(switchIns->case_begin(), switchIns->case_end());
+    std::stable_sort(switchCases.begin(), switchCases.end(), [&weights](const auto& a, const auto& b) {
+        if (!weights.empty() && weights[a.getSuccessorIndex()] != weights[b.getSuccessorIndex()]) {
+            return weights[a.getSuccessorIndex()] > weights[b.getSuccessorIndex()];
+        }
+        return a.getCaseValue()->getSExtValue() < b.getCaseValue()->getSExtValue();
+    });
+
+    for (auto& switchCase : switchCases) {
         Block *target = func->createBlockIfNotExist(switchCase.getCaseSuccessor());
-        cases[switchCase.getCaseValue()->getSExtValue()] = createListOfOneGoto(block, target);
+        cases.push_back({ switchCase.getCaseValue()->getSExtValue(), createListOfOneGoto(block, target) });
+    }
+
+    if (!weights.empty() && !switchCases.empty() && isLikely(weights[switchCases[0].getSuccessorIndex()], total)) {
+        // __builtin_expect works on long, the unsigned values are converted to it the same way as the literal
+        const auto* likely = switchCases[0].getCaseValue();
+        const auto* IT = llvm::dyn_cast_or_null<IntegerType>(cmp->getType());
+        std::string expected = IT && IT->unsignedType ? std::to_string(likely->getZExtValue()) + "u" : std::to_string(likely->getSExtValue());
+        cmp = func->program->makeExpr<CastExpr>(buildExpect(*func->program, cmp, expected), cmp->getType());
     }
 
     if (!isConstExpr) {
@@ -449,9 +1051,6 @@ static void parseAsmInst(const llvm::Instruction& ins, Func* func, Block* block)
     case llvm::Instruction::Unreachable:
         inst = "int3";
         break;
-    case llvm::Instruction::Fence:
-        inst = "fence";
-        break;
     default:
         break;
     }
@@ -467,6 +1066,13 @@ static Expr* parseShiftInstruction(const llvm::Instruction& ins, Program& progra
 
     auto* binOp = llvm::cast<const llvm::BinaryOperator>(&ins);
 
+    // vectors have unsigned elements, arithmetic shift needs the signed vector
+    auto* VT = llvm::dyn_cast<VectorType>(program.getType(ins.getType()));
+    if (VT && ins.getOpcode() == llvm::Instruction::AShr) {
+        auto* shift = program.makeExpr<AshrExpr>(castVector(val0, integerVectorOf(VT, false, program), program), val1);
+        return castVector(shift, VT, program);
+    }
+
     std::unique_ptr<Expr> expr;
     switch (ins.getOpcode()) {
     case llvm::Instruction::Shl:
@@ -620,7 +1226,7 @@ std::vector<std::string> getAsmOutputStrings(llvm::InlineAsm::ConstraintInfoVect
     return ret;
 }
 
-static void parseCallInstruction(const llvm::Instruction& ins, Func* func, Block* block) {
+static void parseCallInstruction(const llvm::Instruction& ins, Func* func, Block* block, const BlockPositions& positions) {
     const llvm::Value* value = &ins;
     const llvm::CallInst* callInst = llvm::cast<llvm::CallInst>(&ins);
     Expr* funcValue = nullptr;
@@ -652,7 +1258,27 @@ static void parseCallInstruction(const llvm::Instruction& ins, Func* func, Block
             return;
         }
 
-        if (funcName.substr(0,4).compare("llvm") == 0) {
+        if (const auto* intrinsic = llvm::dyn_cast<llvm::IntrinsicInst>(callInst)) {
+            for (const llvm::Use& param : callInst->args()) {
+                if (!func->getExpr(param)) {
+                    createFuncCallParam(param, *func->program);
+                }
+            }
+
+            if (Expr* expr = parseIntrinsic(*intrinsic, func, block)) {
+                // results kept in variables by the translation are used directly
+                if (llvm::isa<Value>(expr)) {
+                    func->program->addExpr(value, expr);
+                } else {
+                    inlineOrCreateVariable(value, expr, func, block, positions);
+                }
+                return;
+            }
+        }
+
+        if (!getBuiltinName(callInst->getCalledFunction()).empty()) {
+            funcName = getBuiltinName(callInst->getCalledFunction());
+        } else if (funcName.substr(0,4).compare("llvm") == 0) {
             if (isCFunc(trimPrefix(funcName))) {
                 funcName = trimPrefix(funcName);
             } else {
@@ -673,7 +1299,7 @@ static void parseCallInstruction(const llvm::Instruction& ins, Func* func, Block
     }
 
     int i = 0;
-    for (const llvm::Use& param : callInst->arg_operands()) {
+    for (const llvm::Use& param : callInst->args()) {
         //sometimes LLVM uses these functions with more arguments than their C counterparts
         if ((funcName.compare("memcpy") == 0 || funcName.compare("memmove") == 0 || funcName.compare("memset") == 0)  && i == 3) {
             break;
@@ -702,7 +1328,7 @@ static void parseCallInstruction(const llvm::Instruction& ins, Func* func, Block
             block->addExpr(callExpr.get());
             func->createExpr(value, std::move(callExpr));
         } else {
-            inlineOrCreateVariable(value, func->program->addOwnership(std::move(callExpr)), func, block);
+            inlineOrCreateVariable(value, func->program->addOwnership(std::move(callExpr)), func, block, positions);
         }
     }
 }
@@ -769,7 +1395,7 @@ static void parseInlineASM(const llvm::Instruction& ins, Func* func, Block* bloc
     }
 
     std::vector<Expr*> args;
-    for (const llvm::Use& arg : callInst->arg_operands()) {
+    for (const llvm::Use& arg : callInst->args()) {
         if (!func->getExpr(arg.get())) {
             createFuncCallParam(arg, *func->program);
         }
@@ -864,6 +1490,13 @@ static void parseBitcastInstruction(const llvm::Instruction& ins, Func* func, Bl
 
     const llvm::CastInst* CI = llvm::cast<const llvm::CastInst>(&ins);
 
+    // elements of <N x i1> are stored in larger integers
+    for (const llvm::Type* type : { CI->getSrcTy(), CI->getDestTy() }) {
+        if (type->isVectorTy() && type->getScalarSizeInBits() == 1) {
+            throw std::invalid_argument("Bitcast of vector of i1 is not supported!");
+        }
+    }
+
     auto* unionVar = static_cast<Value*>(program.makeExpr<Value>(func->getVarName(), program.bitcastUnion));
     auto* stackAlloc = program.makeExpr<StackAlloc>(unionVar);
 
@@ -878,6 +1511,40 @@ static void parseBitcastInstruction(const llvm::Instruction& ins, Func* func, Bl
 
 }
 
+/**
+ * @brief Parses conversion of vector @expr to vector @type. Elements are converted by __builtin_convertvector,
+ * the signed operations convert the signed vector. Sign extension of i1 negates the elements.
+ */
+static Expr* parseVectorCastInstruction(const llvm::CastInst* CI, Expr* expr, VectorType* type, Program& program) {
+    auto* sourceType = llvm::cast<VectorType>(program.getType(CI->getSrcTy()));
+
+    switch (CI->getOpcode()) {
+    case llvm::Instruction::SExt:
+    case llvm::Instruction::SIToFP: {
+        Expr* source = castVector(expr, integerVectorOf(sourceType, false, program), program);
+        if (CI->getSrcTy()->getScalarSizeInBits() == 1) {
+            source = program.makeExpr<MinusExpr>(source);
+        }
+        return convertVector(source, type, program);
+    }
+    case llvm::Instruction::FPToSI:
+        return castVector(convertVector(expr, integerVectorOf(type, false, program), program), type, program);
+    case llvm::Instruction::Trunc:
+        if (CI->getDestTy()->getScalarSizeInBits() == 1) {
+            return program.makeExpr<AndExpr>(convertVector(expr, type, program), program.makeExpr<Value>("1", program.typeHandler.uint.get()));
+        }
+        return convertVector(expr, type, program);
+    case llvm::Instruction::ZExt:
+    case llvm::Instruction::UIToFP:
+    case llvm::Instruction::FPToUI:
+    case llvm::Instruction::FPTrunc:
+    case llvm::Instruction::FPExt:
+        return convertVector(expr, type, program);
+    default:
+        throw std::invalid_argument("Vectors of pointers are not supported!");
+    }
+}
+
 static Expr* parseCastInstruction(const llvm::Instruction& ins, Program& program) {
     Expr* expr = program.getExpr(ins.getOperand(0));
     assert(expr);
@@ -889,6 +1556,17 @@ static Expr* parseCastInstruction(const llvm::Instruction& ins, Program& program
 
     const llvm::CastInst* CI = llvm::cast<const llvm::CastInst>(&ins);
 
+    if (auto* VT = llvm::dyn_cast<VectorType>(program.getType(CI->getDestTy()))) {
+        return parseVectorCastInstruction(CI, expr, VT, program);
+    }
+
+    // zext and sext extend the operand as unsigned and signed, the operand may be of the other signedness
+    auto* operandType = llvm::dyn_cast_or_null<IntegerType>(expr->getType());
+    bool isExtension = llvm::isa<llvm::ZExtInst>(CI) || llvm::isa<llvm::SExtInst>(CI);
+    if (isExtension && operandType && operandType->unsignedType != llvm::isa<llvm::ZExtInst>(CI)) {
+        expr = program.makeExpr<CastExpr>(expr, program.typeHandler.toggleSignedness(operandType));
+    }
+
     auto castExpr = program.makeExpr<CastExpr>(expr, program.getType(CI->getDestTy()));
 
     auto IT = static_cast<IntegerType*>(castExpr->getType());
@@ -919,6 +1597,21 @@ static Expr* parseSelectInstruction(const llvm::Instruction& ins, Program& progr
     Expr* val1 = program.getExpr(ins.getOperand(2));
     assert(val0 && val1);
 
+    // the elements are blended by masks, as C has no conditional operator on vectors
+    if (SI->getCondition()->getType()->isVectorTy()) {
+        auto* type = llvm::cast<VectorType>(program.getType(ins.getType()));
+        auto* maskType = integerVectorOf(type, false, program);
+        Expr* condition = convertVector(cond, maskType, program);
+
+        auto* one = program.makeExpr<Value>("1", program.typeHandler.sint.get());
+        auto* trueMask = program.makeExpr<MinusExpr>(condition);
+        auto* falseMask = program.makeExpr<SubExpr>(condition, one, false);
+
+        auto* trueElements = program.makeExpr<AndExpr>(castVector(val0, maskType, program), trueMask);
+        auto* falseElements = program.makeExpr<AndExpr>(castVector(val1, maskType, program), falseMask);
+        return castVector(program.makeExpr<OrExpr>(trueElements, falseElements), type, program);
+    }
+
     return program.makeExpr<SelectExpr>(cond, val0, val1);
 }
 
@@ -1019,6 +1712,12 @@ Expr* parseLLVMInstruction(const llvm::Instruction& ins, Program& program) {
         return parseGepInstruction(ins, program);
     case llvm::Instruction::ExtractValue:
         return parseExtractValueInstruction(ins, program);
+    case llvm::Instruction::ExtractElement:
+        return parseExtractElementInstruction(ins, program);
+    case llvm::Instruction::InsertElement:
+        return parseInsertElementInstruction(ins, program);
+    case llvm::Instruction::ShuffleVector:
+        return parseShuffleVectorInstruction(ins, program);
     case llvm::Instruction::BitCast:
         return parseConstantBitcast(ins, program);
     case llvm::Instruction::SExt:
@@ -1046,10 +1745,14 @@ void createExpressions(const llvm::Module* module, Program& program) {
     assert(program.isPassCompleted(PassType::CreateFunctionParameters));
     assert(program.isPassCompleted(PassType::PrepareBitcastUnion));
 
+    BlockPositions positions;
+
     for (const auto& function : module->functions()) {
+        FunctionScope functionScope(program, function);
         auto* func = program.getFunction(&function);
         for (const auto& block : function) {
             auto* myBlock = func->getBlock(&block);
+            computeBlockPositions(block, positions);
 
             for (const auto& ins : block) {
                 Expr* expr = nullptr;
@@ -1072,12 +1775,20 @@ void createExpressions(const llvm::Module* module, Program& program) {
                         myBlock->addExpr(expr);
                     break;
                 case llvm::Instruction::Call:
-                    parseCallInstruction(ins, func, myBlock);
+                    parseCallInstruction(ins, func, myBlock, positions);
                     break;
                 case llvm::Instruction::Unreachable:
-                case llvm::Instruction::Fence:
                     parseAsmInst(ins, func, myBlock);
                     break;
+                case llvm::Instruction::Fence:
+                    parseFenceInstruction(ins, func, myBlock);
+                    break;
+                case llvm::Instruction::AtomicRMW:
+                    parseAtomicRMWInstruction(ins, func, myBlock, positions);
+                    break;
+                case llvm::Instruction::AtomicCmpXchg:
+                    parseCmpXchgInstruction(ins, func, myBlock);
+                    break;
                 case llvm::Instruction::BitCast:
                     parseBitcastInstruction(ins, func, myBlock, program);
                     break;
@@ -1085,7 +1796,7 @@ void createExpressions(const llvm::Module* module, Program& program) {
                     expr = parseLLVMInstruction(ins, program);
                     if (expr) {
                         program.addExpr(&ins, expr);
-                        inlineOrCreateVariable(&ins, expr, func, myBlock);
+                        inlineOrCreateVariable(&ins, expr, func, myBlock, positions);
                     }
                 }
             }
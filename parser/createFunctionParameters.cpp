@@ -4,10 +4,16 @@
 
 #include <llvm/IR/Instruction.h>
 #include <iostream>
+#include <set>
+
+// the C compilers replace these functions by builtins computed in signed types, so they are declared with them
+static const std::set<std::string> SIGNED_FUNCTIONS = { "abs", "labs", "llabs" };
 
 static void createArgs(Program& program, const llvm::Function* llvmFunc, Func* func) {
+    bool isSigned = llvmFunc->isDeclaration() && SIGNED_FUNCTIONS.count(llvmFunc->getName().str());
+
     const llvm::Value* lastValue;
-    for (const llvm::Value& arg : llvmFunc->args()) {
+    for (const llvm::Argument& arg : llvmFunc->args()) {
         lastValue = &arg;
         auto* argExpr = static_cast<Value*>(func->getExpr(lastValue));
 
@@ -17,13 +23,29 @@ static void createArgs(Program& program, const llvm::Function* llvmFunc, Func* f
             func->createExpr(lastValue, std::move(argVal));
         }
 
+        auto* IT = llvm::dyn_cast_or_null<IntegerType>(argExpr->getType());
+        if (isSigned && IT) {
+            argExpr->setType(program.typeHandler.setSigned(IT));
+        }
+
         func->parameters.push_back(argExpr);
+
+        // restrict is allowed only for pointers to objects, pointers to arrays are written differently
+        const auto* PT = llvm::dyn_cast_or_null<PointerType>(argExpr->getType());
+        if (arg.hasNoAliasAttr() && PT && !PT->isArrayPointer) {
+            func->restrictParameters.insert(argExpr);
+        }
     }
 
     auto lastArg = program.exprMap[lastValue];
     if (lastArg) {
         func->setVarArg(llvmFunc->isVarArg());
     }
+
+    auto* returnType = llvm::dyn_cast_or_null<IntegerType>(func->returnType);
+    if (isSigned && returnType) {
+        func->returnType = program.typeHandler.setSigned(returnType);
+    }
 }
 
 void createFunctionParameters(const llvm::Module* module, Program& program) {
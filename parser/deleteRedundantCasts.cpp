@@ -7,6 +7,10 @@
 #include "SimplifyingExprVisitor.h"
 
 class RedundantCastsVisitor: public SimplifyingExprVisitor {
+private:
+    unsigned& removedCasts;
+public:
+    RedundantCastsVisitor(unsigned& removedCasts) : removedCasts(removedCasts) {}
 protected:
     Expr* simplify(Expr* expr) override;
 };
@@ -14,9 +18,10 @@ protected:
 void deleteRedundantCasts(const llvm::Module* module, Program& program) {
     assert(program.isPassCompleted(PassType::CreateExpressions));
 
-    RedundantCastsVisitor rcv;
+    RedundantCastsVisitor rcv(program.stats.removedCasts);
 
     for (const llvm::Function& func : module->functions()) {
+        FunctionScope functionScope(program, func);
         auto* function = program.getFunction(&func);
         for (const auto& block : func) {
             auto* myBlock = function->getBlock(&block);
@@ -31,12 +36,55 @@ void deleteRedundantCasts(const llvm::Module* module, Program& program) {
     program.addPass(PassType::DeleteRedundantCasts);
 }
 
+/**
+ * @brief Returns the size of the integer type in bytes, 0 for other types.
+ */
+static unsigned integerSize(const Type* type) {
+    if (llvm::isa<CharType>(type)) {
+        return 1;
+    }
+    if (llvm::isa<ShortType>(type)) {
+        return 2;
+    }
+    if (llvm::isa<IntType>(type)) {
+        return 4;
+    }
+    if (llvm::isa<LongType>(type)) {
+        return 8;
+    }
+    if (llvm::isa<Int128>(type)) {
+        return 16;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Returns whether the cast @inner can be removed from the cast @outer. Casts of integers to a type that is not
+ * narrower than @outer keep all bits the outer cast uses, casts to a narrower type (trunc followed by zext or sext) change the value.
+ */
+static bool isRemovable(const CastExpr* outer, const CastExpr* inner) {
+    unsigned innerSize = integerSize(inner->getType());
+    if (innerSize == 0) {
+        return true;
+    }
+
+    const Type* operandType = inner->expr->getType();
+    bool isIntegerOperand = integerSize(operandType) != 0 || llvm::isa<PointerType>(operandType);
+    return isIntegerOperand && innerSize >= integerSize(outer->getType()) && integerSize(outer->getType()) != 0;
+}
+
 Expr* RedundantCastsVisitor::simplify(Expr* expr) {
     if (auto* cast = llvm::dyn_cast_or_null<CastExpr>(expr)) {
         Expr* innermost = cast->expr;
 
         while (auto* inner = llvm::dyn_cast_or_null<CastExpr>(innermost)) {
+            if (!isRemovable(cast, inner)) {
+                break;
+            }
+
             innermost = inner->expr;
+            removedCasts++;
         }
 
         cast->expr = innermost;
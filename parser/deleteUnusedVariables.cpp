@@ -1,5 +1,7 @@
 #include <llvm/IR/Instruction.h>
 #include <iostream>
+#include <algorithm>
+#include <unordered_set>
 
 #include "../core/Program.h"
 #include "../core/Func.h"
@@ -7,21 +9,28 @@
 
 #include "SimplifyingExprVisitor.h"
 
-static void deleteExprFromBlock(Block* block, Expr* toDelete) {
-    for (auto it = block->expressions.begin(); it != block->expressions.end(); ++it) {
-        if (*it == toDelete) {
-            block->expressions.erase(it);
-            return;
-        }
+/**
+ * Removes all expressions in @toDelete from @block in one sweep.
+ */
+static void deleteExprsFromBlock(Block* block, const std::unordered_set<Expr*>& toDelete) {
+    if (toDelete.empty()) {
+        return;
     }
+
+    auto& expressions = block->expressions;
+    expressions.erase(std::remove_if(expressions.begin(), expressions.end(), [&toDelete](Expr* expr) {
+        return toDelete.count(expr) != 0;
+    }), expressions.end());
 }
 
 void deleteUnusedVariables(const llvm::Module* module, Program& program) {
     assert(program.isPassCompleted(PassType::CreateExpressions));
     for (const llvm::Function& func : module->functions()) {
+        FunctionScope functionScope(program, func);
         auto* function = program.getFunction(&func);
         for (const auto& block : func) {
             auto* myBlock = function->getBlock(&block);
+            std::unordered_set<Expr*> toDelete;
 
             for (const auto& ins : block) {
                 if (ins.getOpcode() == llvm::Instruction::Alloca) {
@@ -34,12 +43,15 @@ void deleteUnusedVariables(const llvm::Module* module, Program& program) {
 
                         // make sure the allocation is only used as a target of store
                         if (user->getValueOperand() != &ins && user->getPointerOperand() == &ins) {
-                            deleteExprFromBlock(myBlock, alloca);
-                            deleteExprFromBlock(myBlock, function->getExpr(user));
+                            toDelete.insert(alloca);
+                            toDelete.insert(function->getExpr(user));
+                            program.stats.deletedAllocas++;
                         }
                     }
                 }
             }
+
+            deleteExprsFromBlock(myBlock, toDelete);
         }
     }
 
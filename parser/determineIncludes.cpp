@@ -3,6 +3,7 @@
 #include "../core/Block.h"
 
 #include <llvm/IR/Instruction.h>
+#include <llvm/IR/Intrinsics.h>
 
 #include <regex>
 
@@ -94,6 +95,21 @@ std::string trimPrefix(const std::string& func) {
     return "";
 }
 
+std::string getBuiltinName(const llvm::Function* func) {
+    switch (func->getIntrinsicID()) {
+    case llvm::Intrinsic::expect:
+        return "__builtin_expect";
+    case llvm::Intrinsic::expect_with_probability:
+        return "__builtin_expect_with_probability";
+    default:
+        return "";
+    }
+}
+
+bool isBuiltin(const std::string& func) {
+    return func.compare(0, 10, "__builtin_") == 0;
+}
+
 
 void determineIncludes(const llvm::Module* module, Program& program) {
     for (const llvm::Function& func : module->functions()) {
@@ -4,41 +4,29 @@
 
 #include <llvm/IR/Instruction.h>
 
-static void deleteExprFromBlock(Block* block, Expr* toDelete) {
-    for (auto it = block->expressions.begin(); it != block->expressions.end(); ++it) {
-        if (*it == toDelete) {
-            block->expressions.erase(it);
-            return;
-        }
-    }
-}
-
-
 void extractVars(const llvm::Module* module, Program& program) {
     assert(program.isPassCompleted(PassType::CreateAllocas));
     assert(program.isPassCompleted(PassType::CreateExpressions));
 
     for (const auto& func : module->functions()) {
+        FunctionScope functionScope(program, func);
         auto* function = program.getFunction(&func);
 
         for (const auto& block : func) {
-            std::vector<StackAlloc*> allocs;
-            // 1. find allocas
             auto* myBlock = function->getBlock(&block);
-            for (const auto& expr : myBlock->expressions) {
+            auto& expressions = myBlock->expressions;
+
+            // move allocas to the beginning of function in one sweep over the block,
+            // ownership can stay in principle
+            auto kept = expressions.begin();
+            for (auto* expr : expressions) {
                 if (auto alloc = llvm::dyn_cast_or_null<StackAlloc>(expr)) {
-                    allocs.push_back(alloc);
+                    function->variables.push_back(alloc->value);
+                } else {
+                    *kept++ = expr;
                 }
             }
-
-            for (auto* alloc : allocs) {
-                // 2. remove them from block->expressions (ownership can stay in principle)
-                deleteExprFromBlock(myBlock, alloc);
-
-                // 3. add them at the beginning of function
-                function->variables.push_back(alloc->value);
-            }
-
+            expressions.erase(kept, expressions.end());
         }
 
     }
@@ -10,6 +10,7 @@ void findMetadataFunctionNames(const llvm::Module* module, Program& program) {
     assert(program.isPassCompleted(PassType::CreateFunctions));
 
     for (const llvm::Function& func : module->functions()) {
+        FunctionScope functionScope(program, func);
         if (func.isDeclaration())
             continue;
 
@@ -40,6 +40,7 @@ void findMetadataVariableNames(const llvm::Module* module, Program& program) {
     assert(program.isPassCompleted(PassType::CreateAllocas));
 
     for (const auto& function : module->functions()) {
+        FunctionScope functionScope(program, function);
         auto* func = program.getFunction(&function);
         for (const auto& block : function) {
             auto* myBlock = func->getBlock(&block);
@@ -23,6 +23,7 @@ void identifyInlinableBlocks(const llvm::Module* module, Program& program) {
     assert(program.isPassCompleted(PassType::ParseBreaks));
 
     for (const llvm::Function& func : module->functions()) {
+        FunctionScope functionScope(program, func);
         auto* function = program.getFunction(&func);
         for (const auto& block : func) {
             auto* myBlock = function->createBlockIfNotExist(&block);
@@ -8,8 +8,9 @@
 class InliningVisitor : public SimplifyingExprVisitor {
 private:
     Block* container;
+    unsigned& inlinedBlocks;
 public:
-    InliningVisitor(Block* container) : container(container) {}
+    InliningVisitor(Block* container, unsigned& inlinedBlocks) : container(container), inlinedBlocks(inlinedBlocks) {}
     Expr* simplify(Expr* expr) override;
 };
 
@@ -18,6 +19,7 @@ Expr* InliningVisitor::simplify(Expr* expr) {
         Block* target = gotoExpr->target;
 
         if (target->doInline) {
+            inlinedBlocks++;
             std::vector<Expr*> targetBlockExpressions;
             for (auto* expr : target->expressions) {
                 expr->accept(*this);
@@ -39,10 +41,11 @@ void inlineBlocks(const llvm::Module* module, Program& program) {
 
 
     for (const llvm::Function& func : module->functions()) {
+        FunctionScope functionScope(program, func);
         auto* function = program.getFunction(&func);
         for (const auto& block : func) {
             auto* myBlock = function->createBlockIfNotExist(&block);
-            InliningVisitor iv(myBlock);
+            InliningVisitor iv(myBlock, program.stats.inlinedBlocks);
 
             for (auto& expr : myBlock->expressions) {
                 expr->accept(iv);
@@ -0,0 +1,357 @@
+#include "intrinsics.h"
+
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/Intrinsics.h>
+
+#include <unordered_map>
+
+using IntrinsicParser = Expr* (*)(const llvm::IntrinsicInst& call, Func* func, Block* block);
+
+/**
+ * @brief Returns the width of the scalar integer type, 0 for vectors and integers of other widths than 8, 16, 32 and 64,
+ * which the builtins of the C types would compute in a wider type.
+ */
+static unsigned scalarWidth(const llvm::Type* type) {
+    if (!type->isIntegerTy()) {
+        return 0;
+    }
+
+    unsigned width = type->getIntegerBitWidth();
+    return width == 8 || width == 16 || width == 32 || width == 64 ? width : 0;
+}
+
+/**
+ * @brief Returns whether the i1 flag argument (is_zero_poison, is_int_min_poison) is set.
+ */
+static bool isFlagSet(const llvm::IntrinsicInst& call, unsigned index) {
+    return llvm::cast<llvm::ConstantInt>(call.getArgOperand(index))->isOne();
+}
+
+/**
+ * @brief Returns the argument cast to the signedness the intrinsic works with. The cast is written even if the type
+ * of the expression already has the signedness, constants are written as literals of int and types of loaded variables
+ * may differ from their declarations refined by the metadata.
+ */
+static Expr* argument(const llvm::IntrinsicInst& call, unsigned index, Func* func, bool isUnsigned) {
+    auto& typeHandler = func->program->typeHandler;
+    auto* IT = llvm::cast<IntegerType>(func->getType(call.getArgOperand(index)->getType()));
+    auto* type = isUnsigned ? typeHandler.setUnsigned(IT) : typeHandler.setSigned(IT);
+    return func->program->makeExpr<CastExpr>(func->getExpr(call.getArgOperand(index)), type);
+}
+
+static Expr* integer(unsigned value, Program& program) {
+    return program.makeExpr<Value>(std::to_string(value), program.typeHandler.uint.get());
+}
+
+/**
+ * @brief Writes the result of operation done in int as type of the call, integers shorter than int are promoted.
+ * The result is masked, because deleteRedundantCasts removes the cast when the result is extended.
+ */
+static Expr* truncateIfPromoted(Expr* expr, const llvm::IntrinsicInst& call, Func* func) {
+    unsigned width = scalarWidth(call.getType());
+    if (width >= 32) {
+        return expr;
+    }
+
+    auto& program = *func->program;
+    auto* masked = program.makeExpr<AndExpr>(expr, integer((1u << width) - 1, program));
+    return program.makeExpr<CastExpr>(masked, func->getType(call.getType()));
+}
+
+static Expr* parseCtpop(const llvm::IntrinsicInst& call, Func* func, Block* block) {
+    unsigned width = scalarWidth(call.getType());
+    if (width == 0) {
+        return nullptr;
+    }
+
+    std::string name = width == 64 ? "__builtin_popcountl" : "__builtin_popcount";
+    return func->program->makeExpr<CallExpr>(nullptr, name, std::vector<Expr*>{ argument(call, 0, func, true) }, func->getType(call.getType()));
+}
+
+/**
+ * @brief Parses ctlz and cttz. Integers shorter than int are counted in unsigned int, so leading zeros
+ * of the extension are subtracted. The builtins are undefined for zero, which is checked unless it is poison.
+ */
+static Expr* parseCountZeros(const llvm::IntrinsicInst& call, Func* func, Block* block) {
+    unsigned width = scalarWidth(call.getType());
+    if (width == 0) {
+        return nullptr;
+    }
+
+    auto& program = *func->program;
+    auto* type = func->getType(call.getType());
+    bool leading = call.getIntrinsicID() == llvm::Intrinsic::ctlz;
+    Expr* value = argument(call, 0, func, true);
+
+    std::string name = leading ? "__builtin_clz" : "__builtin_ctz";
+    if (width == 64) {
+        name += "l";
+    }
+
+    Expr* count = program.makeExpr<CallExpr>(nullptr, name, std::vector<Expr*>{ value }, type);
+    if (leading && width < 32) {
+        count = program.makeExpr<SubExpr>(count, integer(32 - width, program), true);
+    }
+
+    if (!isFlagSet(call, 1)) {
+        count = program.makeExpr<SelectExpr>(value, count, program.makeExpr<Value>(std::to_string(width), type));
+    }
+
+    return count;
+}
+
+static Expr* parseBswap(const llvm::IntrinsicInst& call, Func* func, Block* block) {
+    unsigned width = scalarWidth(call.getType());
+    if (width != 16 && width != 32 && width != 64) {
+        return nullptr;
+    }
+
+    std::string name = "__builtin_bswap" + std::to_string(width);
+    return func->program->makeExpr<CallExpr>(nullptr, name, std::vector<Expr*>{ argument(call, 0, func, true) }, func->getType(call.getType()));
+}
+
+/**
+ * @brief Parses fshl and fshr. Constant shifts are written as (a << c) | (b >> (width - c)), variable shifts
+ * of rotations use the (x << (s & m)) | (x >> (-s & m)) idiom and funnel shifts split the shift of the second
+ * operand in two, so that no shift is by the width of the type. The C compilers recognize all of them as rotations or shld/shrd.
+ */
+static Expr* parseFunnelShift(const llvm::IntrinsicInst& call, Func* func, Block* block) {
+    unsigned width = scalarWidth(call.getType());
+    if (width == 0) {
+        return nullptr;
+    }
+
+    auto& program = *func->program;
+    bool left = call.getIntrinsicID() == llvm::Intrinsic::fshl;
+    Expr* high = argument(call, 0, func, true);
+    Expr* low = argument(call, 1, func, true);
+
+    Expr* highShifted = nullptr;
+    Expr* lowShifted = nullptr;
+    if (const auto* CI = llvm::dyn_cast<llvm::ConstantInt>(call.getArgOperand(2))) {
+        unsigned shift = CI->getZExtValue() % width;
+        if (shift == 0) {
+            return left ? high : low;
+        }
+
+        unsigned highShift = left ? shift : width - shift;
+        highShifted = program.makeExpr<ShlExpr>(high, integer(highShift, program), true);
+        lowShifted = program.makeExpr<LshrExpr>(low, integer(width - highShift, program));
+    } else {
+        Expr* shift = program.makeExpr<AndExpr>(argument(call, 2, func, true), integer(width - 1, program));
+
+        if (call.getArgOperand(0) == call.getArgOperand(1)) {
+            Expr* inverse = program.makeExpr<AndExpr>(program.makeExpr<MinusExpr>(argument(call, 2, func, true)), integer(width - 1, program));
+            highShifted = program.makeExpr<ShlExpr>(high, left ? shift : inverse, true);
+            lowShifted = program.makeExpr<LshrExpr>(low, left ? inverse : shift);
+        } else {
+            // width - 1 - (s & m) is the shift by width - s decreased by one
+            Expr* inverse = program.makeExpr<SubExpr>(integer(width - 1, program), shift, true);
+            if (left) {
+                highShifted = program.makeExpr<ShlExpr>(high, shift, true);
+                lowShifted = program.makeExpr<LshrExpr>(program.makeExpr<LshrExpr>(low, integer(1, program)), inverse);
+            } else {
+                highShifted = program.makeExpr<ShlExpr>(program.makeExpr<ShlExpr>(high, integer(1, program), true), inverse, true);
+                lowShifted = program.makeExpr<LshrExpr>(low, shift);
+            }
+        }
+    }
+
+    return truncateIfPromoted(program.makeExpr<OrExpr>(highShifted, lowShifted), call, func);
+}
+
+static Expr* parseMinMax(const llvm::IntrinsicInst& call, Func* func, Block* block) {
+    if (scalarWidth(call.getType()) == 0) {
+        return nullptr;
+    }
+
+    auto id = call.getIntrinsicID();
+    bool isUnsigned = id == llvm::Intrinsic::umin || id == llvm::Intrinsic::umax;
+    bool isMin = id == llvm::Intrinsic::umin || id == llvm::Intrinsic::smin;
+
+    auto* cmp = func->program->makeExpr<CmpExpr>(argument(call, 0, func, isUnsigned), argument(call, 1, func, isUnsigned), isMin ? "<" : ">", isUnsigned);
+    return func->program->makeExpr<SelectExpr>(cmp, argument(call, 0, func, true), argument(call, 1, func, true));
+}
+
+/**
+ * @brief Parses abs. The builtins return the minimal value for it, as LLVM does, only for integers
+ * shorter than int (abs of them fits int), so the minimal value of int and long is handled explicitly unless it is poison.
+ */
+static Expr* parseAbs(const llvm::IntrinsicInst& call, Func* func, Block* block) {
+    unsigned width = scalarWidth(call.getType());
+    if (width == 0) {
+        return nullptr;
+    }
+
+    auto& program = *func->program;
+    auto* type = func->getType(call.getType());
+
+    if (width < 32 || isFlagSet(call, 1)) {
+        std::string name = width == 64 ? "__builtin_labs" : "__builtin_abs";
+        return program.makeExpr<CallExpr>(nullptr, name, std::vector<Expr*>{ argument(call, 0, func, false) }, type);
+    }
+
+    auto* negative = program.makeExpr<CmpExpr>(argument(call, 0, func, false), program.makeExpr<Value>("0", program.typeHandler.sint.get()), "<", false);
+    Expr* value = argument(call, 0, func, true);
+    return program.makeExpr<SelectExpr>(negative, program.makeExpr<MinusExpr>(value), value);
+}
+
+/**
+ * @brief Parses *.with.overflow. The result is stored in the first item of the structure
+ * by __builtin_*_overflow, which checks the overflow in the type the result points to.
+ */
+static Expr* parseWithOverflow(const llvm::IntrinsicInst& call, Func* func, Block* block) {
+    if (scalarWidth(call.getArgOperand(0)->getType()) == 0) {
+        return nullptr;
+    }
+
+    auto& program = *func->program;
+    auto id = call.getIntrinsicID();
+
+    std::string name;
+    if (id == llvm::Intrinsic::sadd_with_overflow || id == llvm::Intrinsic::uadd_with_overflow) {
+        name = "__builtin_add_overflow";
+    } else if (id == llvm::Intrinsic::ssub_with_overflow || id == llvm::Intrinsic::usub_with_overflow) {
+        name = "__builtin_sub_overflow";
+    } else {
+        name = "__builtin_mul_overflow";
+    }
+
+    bool isUnsigned = id == llvm::Intrinsic::uadd_with_overflow || id == llvm::Intrinsic::usub_with_overflow || id == llvm::Intrinsic::umul_with_overflow;
+
+    auto* var = program.makeExpr<Value>(func->getVarName(), func->getType(call.getType()));
+    block->addExpr(program.makeExpr<StackAlloc>(static_cast<Value*>(var)));
+
+    auto* result = program.makeExpr<AggregateElement>(var, 0);
+    auto* overflow = program.makeExpr<AggregateElement>(var, 1);
+
+    auto* resultType = static_cast<IntegerType*>(result->getType());
+    Expr* pointer = program.makeExpr<RefExpr>(result, program.typeHandler.pointerTo(resultType));
+    if (!isUnsigned) {
+        pointer = program.makeExpr<CastExpr>(pointer, program.typeHandler.pointerTo(program.typeHandler.setSigned(resultType)));
+    }
+
+    // the builtins check the result in infinite precision, so operands are always cast to the signedness of the intrinsic,
+    // types of loaded variables may differ from their declarations refined by the metadata
+    auto* operandType = isUnsigned ? program.typeHandler.setUnsigned(resultType) : program.typeHandler.setSigned(resultType);
+    std::vector<Expr*> params{
+        program.makeExpr<CastExpr>(func->getExpr(call.getArgOperand(0)), operandType),
+        program.makeExpr<CastExpr>(func->getExpr(call.getArgOperand(1)), operandType),
+        pointer,
+    };
+    auto* check = program.makeExpr<CallExpr>(nullptr, name, params, overflow->getType());
+    block->addExpr(program.makeExpr<AssignExpr>(overflow, check));
+
+    return var;
+}
+
+/**
+ * @brief Parses fmuladd as a * b + c, which the C compilers contract to fma when the target has it.
+ * Call of fma would be a call of the library on targets without it.
+ */
+static Expr* parseFmuladd(const llvm::IntrinsicInst& call, Func* func, Block* block) {
+    auto& program = *func->program;
+    auto* mul = program.makeExpr<MulExpr>(func->getExpr(call.getArgOperand(0)), func->getExpr(call.getArgOperand(1)), true);
+    return program.makeExpr<AddExpr>(mul, func->getExpr(call.getArgOperand(2)), true);
+}
+
+/**
+ * @brief Parses llvm.vector.reduce.* as a chain of operations on the elements of the vector,
+ * floating point reductions start with the scalar operand.
+ */
+static Expr* parseVectorReduction(const llvm::IntrinsicInst& call, Func* func, Block* block) {
+    auto& program = *func->program;
+    auto id = call.getIntrinsicID();
+
+    const llvm::Value* vector = call.getArgOperand(call.arg_size() - 1);
+    auto* VT = llvm::cast<VectorType>(func->getType(vector->getType()));
+
+    Expr* result = nullptr;
+    if (id == llvm::Intrinsic::vector_reduce_fadd || id == llvm::Intrinsic::vector_reduce_fmul) {
+        result = func->getExpr(call.getArgOperand(0));
+    }
+
+    for (unsigned i = 0; i < VT->size; i++) {
+        Expr* element = program.makeExpr<ArrayElement>(func->getExpr(vector), integer(i, program), VT->elementType);
+
+        if (!result) {
+            result = element;
+        } else if (id == llvm::Intrinsic::vector_reduce_add || id == llvm::Intrinsic::vector_reduce_fadd) {
+            result = program.makeExpr<AddExpr>(result, element, true);
+        } else if (id == llvm::Intrinsic::vector_reduce_mul || id == llvm::Intrinsic::vector_reduce_fmul) {
+            result = program.makeExpr<MulExpr>(result, element, true);
+        } else if (id == llvm::Intrinsic::vector_reduce_and) {
+            result = program.makeExpr<AndExpr>(result, element);
+        } else if (id == llvm::Intrinsic::vector_reduce_or) {
+            result = program.makeExpr<OrExpr>(result, element);
+        } else {
+            result = program.makeExpr<XorExpr>(result, element);
+        }
+    }
+
+    return result;
+}
+
+static const std::unordered_map<llvm::Intrinsic::ID, IntrinsicParser> INTRINSICS = {
+    { llvm::Intrinsic::ctpop, parseCtpop },
+    { llvm::Intrinsic::ctlz, parseCountZeros },
+    { llvm::Intrinsic::cttz, parseCountZeros },
+    { llvm::Intrinsic::bswap, parseBswap },
+    { llvm::Intrinsic::fshl, parseFunnelShift },
+    { llvm::Intrinsic::fshr, parseFunnelShift },
+    { llvm::Intrinsic::smin, parseMinMax },
+    { llvm::Intrinsic::smax, parseMinMax },
+    { llvm::Intrinsic::umin, parseMinMax },
+    { llvm::Intrinsic::umax, parseMinMax },
+    { llvm::Intrinsic::abs, parseAbs },
+    { llvm::Intrinsic::sadd_with_overflow, parseWithOverflow },
+    { llvm::Intrinsic::uadd_with_overflow, parseWithOverflow },
+    { llvm::Intrinsic::ssub_with_overflow, parseWithOverflow },
+    { llvm::Intrinsic::usub_with_overflow, parseWithOverflow },
+    { llvm::Intrinsic::smul_with_overflow, parseWithOverflow },
+    { llvm::Intrinsic::umul_with_overflow, parseWithOverflow },
+    { llvm::Intrinsic::fmuladd, parseFmuladd },
+    { llvm::Intrinsic::vector_reduce_add, parseVectorReduction },
+    { llvm::Intrinsic::vector_reduce_mul, parseVectorReduction },
+    { llvm::Intrinsic::vector_reduce_and, parseVectorReduction },
+    { llvm::Intrinsic::vector_reduce_or, parseVectorReduction },
+    { llvm::Intrinsic::vector_reduce_xor, parseVectorReduction },
+    { llvm::Intrinsic::vector_reduce_fadd, parseVectorReduction },
+    { llvm::Intrinsic::vector_reduce_fmul, parseVectorReduction },
+};
+
+Expr* parseIntrinsic(const llvm::IntrinsicInst& call, Func* func, Block* block) {
+    auto it = INTRINSICS.find(call.getIntrinsicID());
+    if (it == INTRINSICS.end()) {
+        return nullptr;
+    }
+
+    return it->second(call, func, block);
+}
+
+bool repeatsOperands(const llvm::IntrinsicInst& call) {
+    switch (call.getIntrinsicID()) {
+    case llvm::Intrinsic::ctlz:
+    case llvm::Intrinsic::cttz:
+        return !isFlagSet(call, 1);
+    case llvm::Intrinsic::abs:
+        return !isFlagSet(call, 1) && scalarWidth(call.getType()) >= 32;
+    case llvm::Intrinsic::fshl:
+    case llvm::Intrinsic::fshr:
+        return !llvm::isa<llvm::ConstantInt>(call.getArgOperand(2)) || call.getArgOperand(0) == call.getArgOperand(1);
+    case llvm::Intrinsic::smin:
+    case llvm::Intrinsic::smax:
+    case llvm::Intrinsic::umin:
+    case llvm::Intrinsic::umax:
+    case llvm::Intrinsic::vector_reduce_add:
+    case llvm::Intrinsic::vector_reduce_mul:
+    case llvm::Intrinsic::vector_reduce_and:
+    case llvm::Intrinsic::vector_reduce_or:
+    case llvm::Intrinsic::vector_reduce_xor:
+    case llvm::Intrinsic::vector_reduce_fadd:
+    case llvm::Intrinsic::vector_reduce_fmul:
+        return true;
+    default:
+        return false;
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "../core/Program.h"
+#include "../core/Func.h"
+#include "../core/Block.h"
+
+#include <llvm/IR/IntrinsicInst.h>
+
+/**
+ * @brief parseIntrinsic Translates call of an intrinsic to C operators or compiler builtins.
+ * Expressions of all arguments must already exist. Statements needed by the translation are added to the block.
+ * @param call Call of the intrinsic
+ * @param func Function containing the call
+ * @param block Block containing the call
+ * @return Expression of the result, nullptr if the intrinsic is not translated and should be called as a function
+ */
+Expr* parseIntrinsic(const llvm::IntrinsicInst& call, Func* func, Block* block);
+
+/**
+ * @brief repeatsOperands Checks whether the translation of the intrinsic writes some argument more than once,
+ * so the argument must not be inlined into it.
+ * @param call Call of the intrinsic
+ */
+bool repeatsOperands(const llvm::IntrinsicInst& call);
@@ -27,6 +27,7 @@ void memcpyToAssignment(const llvm::Module* module, Program& program) {
     assert(program.isPassCompleted(PassType::CreateExpressions));
 
     for (const auto& function : module->functions()) {
+        FunctionScope functionScope(program, function);
         auto* func = program.getFunction(&function);
         for (const auto& block : function) {
             auto* myBlock = func->getBlock(&block);
@@ -82,6 +83,7 @@ void memcpyToAssignment(const llvm::Module* module, Program& program) {
                                                     Expr* newExpr = assignment.get();
                                                     myBlock->addOwnership(std::move(assignment));
                                                     std::replace(myBlock->expressions.begin(), myBlock->expressions.end(), exprToReplace, newExpr);
+                                                    program.stats.convertedMemcpys++;
                                                 }
                                             }
                                         }
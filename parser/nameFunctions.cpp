@@ -15,6 +15,10 @@ static void nameFunction(const llvm::Function* llvmFunc, Func* func) {
 		}
 	}
 
+	if (!getBuiltinName(llvmFunc).empty()) {
+		name = getBuiltinName(llvmFunc);
+	}
+
 	if (name.substr(0, 4).compare("llvm") == 0) {
 		std::replace(name.begin(), name.end(), '.', '_');
 	}
@@ -3,6 +3,7 @@
 #include "../core/Block.h"
 #include "cfunc.h"
 #include "constval.h"
+#include "branchWeights.h"
 
 #include <llvm/IR/Instruction.h>
 
@@ -60,6 +61,16 @@ static void parseBrInstruction(const llvm::Instruction& ins, Func* func, Block*
 
     Expr* cmp = func->getExpr(ins.getOperand(0));
 
+    // keep the profile of the original build for the C compiler
+    auto weights = getBranchWeights(ins);
+    if (!weights.empty()) {
+        if (isLikely(weights[0], weights[0] + weights[1])) {
+            cmp = buildExpect(*func->program, cmp, "1");
+        } else if (isLikely(weights[1], weights[0] + weights[1])) {
+            cmp = buildExpect(*func->program, cmp, "0");
+        }
+    }
+
     Block* falseBlock = func->createBlockIfNotExist((llvm::BasicBlock*)ins.getOperand(1));
     Block* trueBlock = func->createBlockIfNotExist((llvm::BasicBlock*)ins.getOperand(2));
 
@@ -89,6 +100,7 @@ void parseBreaks(const llvm::Module* module, Program& program) {
     assert(program.isPassCompleted(PassType::CreateExpressions));
 
     for (const auto& function : module->functions()) {
+        FunctionScope functionScope(program, function);
         auto* func = program.getFunction(&function);
         for (const auto& block : function) {
             auto* myBlock = func->getBlock(&block);
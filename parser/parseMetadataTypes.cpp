@@ -9,8 +9,9 @@ static void setMetadataInfo(Program& program, const llvm::CallInst* ins, Block*
     llvm::Value* referredVal = llvm::cast<llvm::ValueAsMetadata>(md)->getValue();
     Expr* referred = block->func->getExpr(referredVal);
 
-    if (auto* re = llvm::dyn_cast_or_null<RefExpr>(referred)) {
-        referred = re->expr;
+    auto* ref = llvm::dyn_cast_or_null<RefExpr>(referred);
+    if (ref) {
+        referred = ref->expr;
     }
 
     if (Value* variable = llvm::dyn_cast_or_null<Value>(referred)) {
@@ -21,6 +22,11 @@ static void setMetadataInfo(Program& program, const llvm::CallInst* ins, Block*
         if (type && type->getName().str().compare(0, 8, "unsigned") == 0) {
             if (IntegerType* IT = llvm::dyn_cast_or_null<IntegerType>(variable->getType())) {
                 variable->setType(program.typeHandler.toggleSignedness(IT));
+
+                // loads of the variable get their type from the reference
+                if (ref) {
+                    ref->setType(program.typeHandler.pointerTo(variable->getType()));
+                }
             }
         }
     }
@@ -30,6 +36,7 @@ void parseMetadataTypes(const llvm::Module* module, Program& program) {
     assert(program.isPassCompleted(PassType::CreateAllocas));
 
     for (const auto& function : module->functions()) {
+        FunctionScope functionScope(program, function);
         auto* func = program.getFunction(&function);
         for (const auto& block : function) {
             auto* myBlock = func->getBlock(&block);
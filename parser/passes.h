@@ -28,6 +28,7 @@ void deleteUnusedVariables(const llvm::Module* module, Program& program);
 void extractVars(const llvm::Module* module, Program& program);
 void arrowify(const llvm::Module* module, Program& program);
 void memcpyToAssignment(const llvm::Module* module, Program& program);
+void structureControlFlow(const llvm::Module* module, Program& program);
 void computeGlobalVarsOrder(const llvm::Module* module, Program& program);
 void createConstants(const llvm::Module* mod, Program& program);
 void inlineBlocks(const llvm::Module* mod, Program& program);
@@ -11,6 +11,7 @@ void prepareBitcastUnion(const llvm::Module* mod, Program& program) {
     std::unordered_set<Type*> types;
 
     for (const auto& function : mod->functions()) {
+        FunctionScope functionScope(program, function);
         for (const auto& bb : function) {
             for (const auto& ins : bb) {
                 if (ins.getOpcode() == llvm::Instruction::BitCast) {
@@ -26,7 +27,7 @@ void prepareBitcastUnion(const llvm::Module* mod, Program& program) {
         std::vector<Type*> typeVector(types.begin(), types.end());
 
         std::sort(typeVector.begin(), typeVector.end(), [](const Type* a, const Type* b) {
-                  return a->toString().compare(b->toString());
+                  return a->toString() < b->toString();
           });
 
         program.bitcastUnion = program.addUnion(typeVector);
@@ -18,6 +18,7 @@ void refDeref(const llvm::Module* module, Program& program) {
     RefDerefVisitor rdv;
 
     for (const llvm::Function& func : module->functions()) {
+        FunctionScope functionScope(program, func);
         auto* function = program.getFunction(&func);
         for (const auto& block : func) {
             auto* myBlock = function->getBlock(&block);
@@ -0,0 +1,506 @@
+#include "../core/Program.h"
+#include "../core/Func.h"
+#include "../core/Block.h"
+
+#include <llvm/IR/Instruction.h>
+#include <llvm/IR/CFG.h>
+#include <llvm/IR/Dominators.h>
+#include <llvm/Analysis/LoopInfo.h>
+#include <llvm/ADT/PostOrderIterator.h>
+
+#include <algorithm>
+#include <unordered_set>
+
+/**
+ * Translates the CFG of a function into nested C statements, in the way of
+ * "Beyond Relooper" (N. Ramsey): every block is emitted inside the code of its
+ * immediate dominator. Blocks with more than one forward predecessor (merge blocks)
+ * and blocks leaving a loop follow the code of the dominator (or the loop), blocks with
+ * a single predecessor are emitted in place of the branch. Branches to an enclosing loop
+ * header become continue, branches to a block that directly follows an enclosing
+ * loop or switch become break, branches to a following block in tail position are
+ * omitted. Everything else (irreducible control flow, multi-level breaks) stays goto.
+ */
+class Structurer {
+private:
+    struct Frame {
+        enum Kind {
+            Follow, // code of `target` follows the code inside the frame
+            Loop, // body of while loop with header `target`
+            Switch, // case of a switch statement
+            Branch, // branch of an if statement
+        } kind;
+
+        const llvm::BasicBlock* target;
+
+        // the statement of the frame is the last one in the enclosing frame
+        bool tail;
+    };
+
+    Func* func;
+    Program& program;
+    llvm::DominatorTree dt;
+    llvm::LoopInfo li;
+
+    llvm::DenseMap<const llvm::BasicBlock*, unsigned> rpo;
+    llvm::DenseMap<const llvm::BasicBlock*, unsigned> forwardPredecessors;
+
+    // blocks written after the code of the dominator (or after the loop of the header), ordered by decreasing rpo
+    llvm::DenseMap<const llvm::BasicBlock*, std::vector<const llvm::BasicBlock*>> followers;
+    llvm::DenseMap<const llvm::BasicBlock*, std::vector<const llvm::BasicBlock*>> loopFollowers;
+    std::unordered_set<const llvm::BasicBlock*> placed;
+    std::unordered_set<const llvm::BasicBlock*> duplicable;
+    std::unordered_set<const llvm::BasicBlock*> emitted;
+
+    std::vector<Frame> frames;
+    std::unordered_set<Block*> gotoTargets;
+
+    bool isBackEdge(const llvm::BasicBlock* from, const llvm::BasicBlock* to) const {
+        return dt.dominates(to, from);
+    }
+
+    bool isLoopHeader(const llvm::BasicBlock* block) const {
+        for (const auto* pred : llvm::predecessors(block)) {
+            if (dt.isReachableFromEntry(pred) && isBackEdge(pred, block)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // block consisting only of return is copied to all its predecessors, as in identifyInlinableBlocks
+    bool isDuplicable(const llvm::BasicBlock* block) const {
+        return duplicable.count(block);
+    }
+
+    void analyze(const llvm::Function& function);
+    void place(const llvm::BasicBlock* block, const llvm::BasicBlock* owner, bool isMerge);
+
+    std::vector<Expr*> emitNode(const llvm::BasicBlock* block, bool tail);
+    void emitWithin(const llvm::BasicBlock* block, std::vector<Expr*>& code, bool tail);
+    void emitExpressions(const llvm::BasicBlock* block, std::vector<Expr*>& code, bool tail);
+    ExprList* translateList(const llvm::BasicBlock* block, Expr* list, bool tail);
+    void translate(const llvm::BasicBlock* block, Expr* expr, std::vector<Expr*>& code, bool tail);
+    void branch(const llvm::BasicBlock* from, const llvm::BasicBlock* to, std::vector<Expr*>& code, bool tail);
+
+    void removeUnusedLabels(Expr* expr);
+    void recoverLoops(Expr* expr);
+    Expr* makeList(std::vector<Expr*>&& code);
+    Expr* negate(Expr* cond);
+
+public:
+    Structurer(Func* func, const llvm::Function& function)
+        : func(func),
+          program(*func->program),
+          dt(const_cast<llvm::Function&>(function)),
+          li(dt) {
+        analyze(function);
+    }
+
+    /**
+     * @brief structure Returns the structured code of the whole function.
+     */
+    Expr* structure(const llvm::Function& function);
+};
+
+void Structurer::analyze(const llvm::Function& function) {
+    llvm::ReversePostOrderTraversal<const llvm::Function*> order(&function);
+    for (const auto* block : order) {
+        rpo[block] = rpo.size();
+    }
+
+    for (const auto* block : order) {
+        for (const auto* succ : llvm::successors(block)) {
+            if (!isBackEdge(block, succ)) {
+                forwardPredecessors[succ]++;
+            }
+        }
+    }
+
+    for (const auto* block : order) {
+        const auto& expressions = func->getBlock(block)->expressions;
+        if (expressions.size() != 1 || !llvm::isa<RetExpr>(expressions.front())) {
+            continue;
+        }
+
+        // the only exit of a loop is kept after the loop, so that the loop can end with break
+        const auto* pred = block->getSinglePredecessor();
+        const auto* loop = pred ? li.getLoopFor(pred) : nullptr;
+        if (!loop || loop->contains(block)) {
+            duplicable.insert(block);
+        }
+    }
+
+    for (const auto* block : order) {
+        if (block == &function.getEntryBlock() || isDuplicable(block)) {
+            continue;
+        }
+
+        const auto* idom = dt.getNode(block)->getIDom()->getBlock();
+        if (forwardPredecessors[block] > 1) {
+            place(block, idom, true);
+            continue;
+        }
+
+        // block with a single predecessor is written in place of the branch, unless it leaves a loop
+        for (const auto* pred : llvm::predecessors(block)) {
+            if (dt.isReachableFromEntry(pred) && !isBackEdge(pred, block)) {
+                place(block, pred, false);
+            }
+        }
+    }
+
+    for (auto* list : { &followers, &loopFollowers }) {
+        for (auto& entry : *list) {
+            std::sort(entry.second.begin(), entry.second.end(), [this](const llvm::BasicBlock* a, const llvm::BasicBlock* b) {
+                return rpo[a] > rpo[b];
+            });
+        }
+    }
+}
+
+void Structurer::place(const llvm::BasicBlock* block, const llvm::BasicBlock* owner, bool isMerge) {
+    // the outermost loop containing the owner but not the block
+    const llvm::Loop* exited = nullptr;
+    for (const auto* loop = li.getLoopFor(owner); loop && !loop->contains(block); loop = loop->getParentLoop()) {
+        exited = loop;
+    }
+
+    if (exited) {
+        loopFollowers[exited->getHeader()].push_back(block);
+        placed.insert(block);
+    } else if (isMerge) {
+        followers[owner].push_back(block);
+        placed.insert(block);
+    }
+}
+
+Expr* Structurer::makeList(std::vector<Expr*>&& code) {
+    return program.makeExpr<ExprList>(std::move(code));
+}
+
+std::vector<Expr*> Structurer::emitNode(const llvm::BasicBlock* block, bool tail) {
+    std::vector<Expr*> code;
+    emitted.insert(block);
+
+    const auto after = loopFollowers.lookup(block);
+    for (const auto* follower : after) {
+        frames.push_back({ Frame::Follow, follower, false });
+    }
+    bool innerTail = after.empty() ? tail : true;
+
+    if (isLoopHeader(block)) {
+        frames.push_back({ Frame::Loop, block, innerTail });
+        std::vector<Expr*> body;
+        emitWithin(block, body, true);
+        frames.pop_back();
+        code.push_back(program.makeExpr<WhileExpr>(nullptr, makeList(std::move(body))));
+    } else {
+        emitWithin(block, code, innerTail);
+    }
+
+    for (auto it = after.rbegin(); it != after.rend(); ++it) {
+        frames.pop_back();
+        auto followerCode = emitNode(*it, it + 1 != after.rend() ? true : tail);
+        code.insert(code.end(), followerCode.begin(), followerCode.end());
+    }
+
+    return code;
+}
+
+void Structurer::emitWithin(const llvm::BasicBlock* block, std::vector<Expr*>& code, bool tail) {
+    code.push_back(program.makeExpr<LabelExpr>(func->getBlock(block)));
+
+    const auto after = followers.lookup(block);
+    for (const auto* follower : after) {
+        frames.push_back({ Frame::Follow, follower, false });
+    }
+
+    emitExpressions(block, code, after.empty() ? tail : true);
+
+    for (auto it = after.rbegin(); it != after.rend(); ++it) {
+        frames.pop_back();
+        auto followerCode = emitNode(*it, it + 1 != after.rend() ? true : tail);
+        code.insert(code.end(), followerCode.begin(), followerCode.end());
+    }
+}
+
+void Structurer::emitExpressions(const llvm::BasicBlock* block, std::vector<Expr*>& code, bool tail) {
+    const auto& expressions = func->getBlock(block)->expressions;
+    for (size_t i = 0; i < expressions.size(); i++) {
+        translate(block, expressions[i], code, tail && i + 1 == expressions.size());
+    }
+}
+
+ExprList* Structurer::translateList(const llvm::BasicBlock* block, Expr* list, bool tail) {
+    std::vector<Expr*> code;
+    translate(block, list, code, tail);
+    return llvm::cast<ExprList>(makeList(std::move(code)));
+}
+
+void Structurer::translate(const llvm::BasicBlock* block, Expr* expr, std::vector<Expr*>& code, bool tail) {
+    if (auto* gotoExpr = llvm::dyn_cast<GotoExpr>(expr)) {
+        branch(block, gotoExpr->target->block, code, tail);
+        return;
+    }
+
+    if (auto* list = llvm::dyn_cast<ExprList>(expr)) {
+        for (size_t i = 0; i < list->expressions.size(); i++) {
+            translate(block, list->expressions[i], code, tail && i + 1 == list->expressions.size());
+        }
+        return;
+    }
+
+    if (auto* ifExpr = llvm::dyn_cast<IfExpr>(expr)) {
+        frames.push_back({ Frame::Branch, nullptr, tail });
+        auto* trueList = translateList(block, ifExpr->trueList, true);
+        auto* falseList = translateList(block, ifExpr->falseList, true);
+        frames.pop_back();
+
+        Expr* cmp = ifExpr->cmp;
+        if (trueList->expressions.empty() && !falseList->expressions.empty()) {
+            cmp = negate(cmp);
+            std::swap(trueList, falseList);
+        }
+
+        code.push_back(program.makeExpr<IfExpr>(cmp, trueList, falseList->expressions.empty() ? nullptr : falseList));
+        return;
+    }
+
+    if (auto* switchExpr = llvm::dyn_cast<SwitchExpr>(expr)) {
+        frames.push_back({ Frame::Switch, nullptr, tail });
+        std::vector<std::pair<int, Expr*>> cases;
+        for (const auto& entry : switchExpr->cases) {
+            cases.push_back({ entry.first, translateList(block, entry.second, true) });
+        }
+        auto* def = translateList(block, switchExpr->def, true);
+        frames.pop_back();
+
+        code.push_back(program.makeExpr<SwitchExpr>(switchExpr->cmp, def, cases));
+        return;
+    }
+
+    code.push_back(expr);
+}
+
+void Structurer::branch(const llvm::BasicBlock* from, const llvm::BasicBlock* to, std::vector<Expr*>& code, bool tail) {
+    if (isBackEdge(from, to)) {
+        // continue applies to the innermost loop, switch statements do not matter
+        bool atEnd = tail;
+        for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+            if (it->kind == Frame::Loop) {
+                if (it->target == to) {
+                    if (!atEnd) {
+                        code.push_back(program.makeExpr<ContinueExpr>());
+                    }
+                    return;
+                }
+                break;
+            }
+            atEnd = atEnd && it->kind == Frame::Branch && it->tail;
+        }
+    } else if (isDuplicable(to)) {
+        const auto& expressions = func->getBlock(to)->expressions;
+        code.insert(code.end(), expressions.begin(), expressions.end());
+        return;
+    } else if (!placed.count(to) && !emitted.count(to)) {
+        auto targetCode = emitNode(to, tail);
+        code.insert(code.end(), targetCode.begin(), targetCode.end());
+        return;
+    } else {
+        bool atEnd = tail;
+        bool broken = false;
+        for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+            if (it->kind == Frame::Follow) {
+                if (it->target == to && atEnd) {
+                    if (broken) {
+                        code.push_back(program.makeExpr<BreakExpr>());
+                    }
+                    return;
+                }
+                atEnd = false;
+            } else if (it->kind == Frame::Branch) {
+                atEnd = atEnd && it->tail;
+            } else {
+                // break leaves only the innermost loop or switch
+                if (broken) {
+                    break;
+                }
+                broken = true;
+                atEnd = it->tail;
+            }
+        }
+    }
+
+    auto* target = func->getBlock(to);
+    gotoTargets.insert(target);
+    code.push_back(program.makeExpr<GotoExpr>(target));
+}
+
+void Structurer::removeUnusedLabels(Expr* expr) {
+    if (auto* list = llvm::dyn_cast<ExprList>(expr)) {
+        auto& expressions = list->expressions;
+        expressions.erase(std::remove_if(expressions.begin(), expressions.end(), [this](Expr* e) {
+            auto* label = llvm::dyn_cast<LabelExpr>(e);
+            return label && !gotoTargets.count(label->block);
+        }), expressions.end());
+
+        for (auto* e : expressions) {
+            removeUnusedLabels(e);
+        }
+    } else if (auto* ifExpr = llvm::dyn_cast<IfExpr>(expr)) {
+        removeUnusedLabels(ifExpr->trueList);
+        if (ifExpr->falseList) {
+            removeUnusedLabels(ifExpr->falseList);
+        }
+    } else if (auto* switchExpr = llvm::dyn_cast<SwitchExpr>(expr)) {
+        for (auto& entry : switchExpr->cases) {
+            removeUnusedLabels(entry.second);
+        }
+        removeUnusedLabels(switchExpr->def);
+    } else if (auto* whileExpr = llvm::dyn_cast<WhileExpr>(expr)) {
+        removeUnusedLabels(whileExpr->body);
+    }
+}
+
+Expr* Structurer::negate(Expr* cond) {
+    if (auto* logicalNot = llvm::dyn_cast<LogicalNot>(cond)) {
+        return logicalNot->expr;
+    }
+    return program.makeExpr<LogicalNot>(cond);
+}
+
+static bool isSingle(const Expr* list, Expr::ExprKind kind) {
+    const auto* exprList = llvm::dyn_cast_or_null<ExprList>(list);
+    return exprList && exprList->expressions.size() == 1 && exprList->expressions.front()->getKind() == kind;
+}
+
+/**
+ * Returns true if @expr contains continue of the loop whose body it is a part of.
+ */
+static bool hasContinue(const Expr* expr) {
+    if (llvm::isa<ContinueExpr>(expr)) {
+        return true;
+    }
+
+    if (const auto* list = llvm::dyn_cast<ExprList>(expr)) {
+        return std::any_of(list->expressions.begin(), list->expressions.end(), hasContinue);
+    }
+
+    if (const auto* ifExpr = llvm::dyn_cast<IfExpr>(expr)) {
+        return hasContinue(ifExpr->trueList) || (ifExpr->falseList && hasContinue(ifExpr->falseList));
+    }
+
+    if (const auto* switchExpr = llvm::dyn_cast<SwitchExpr>(expr)) {
+        for (const auto& entry : switchExpr->cases) {
+            if (hasContinue(entry.second)) {
+                return true;
+            }
+        }
+        return hasContinue(switchExpr->def);
+    }
+
+    // continue in nested loop belongs to that loop
+    return false;
+}
+
+/**
+ * Turns `while (1) { if (c) { ... } else { break; } ... }` into `while (c) { ... }` and
+ * `while (1) { ...; if (!c) { break; } }` into `do { ... } while (c);`.
+ */
+void Structurer::recoverLoops(Expr* expr) {
+    if (auto* list = llvm::dyn_cast<ExprList>(expr)) {
+        for (auto*& e : list->expressions) {
+            recoverLoops(e);
+
+            auto* loop = llvm::dyn_cast<WhileExpr>(e);
+            if (!loop || loop->cond) {
+                continue;
+            }
+
+            auto& body = llvm::cast<ExprList>(loop->body)->expressions;
+            if (body.empty()) {
+                continue;
+            }
+
+            if (auto* first = llvm::dyn_cast<IfExpr>(body.front())) {
+                bool exitsOnFalse = isSingle(first->falseList, Expr::EK_BreakExpr);
+                if (exitsOnFalse || isSingle(first->trueList, Expr::EK_BreakExpr)) {
+                    Expr* cond = exitsOnFalse ? first->cmp : negate(first->cmp);
+                    Expr* rest = exitsOnFalse ? first->trueList : first->falseList;
+
+                    std::vector<Expr*> newBody;
+                    if (rest) {
+                        auto& restExprs = llvm::cast<ExprList>(rest)->expressions;
+                        newBody.insert(newBody.end(), restExprs.begin(), restExprs.end());
+                    }
+                    newBody.insert(newBody.end(), body.begin() + 1, body.end());
+
+                    loop->cond = cond;
+                    loop->body = makeList(std::move(newBody));
+                    continue;
+                }
+            }
+
+            // continue at the end of the body is omitted, so the loop ends with `if (c) { break; }`
+            auto* last = llvm::dyn_cast<IfExpr>(body.back());
+            if (last && !last->falseList && isSingle(last->trueList, Expr::EK_BreakExpr)) {
+                std::vector<Expr*> newBody(body.begin(), body.end() - 1);
+
+                if (!std::any_of(newBody.begin(), newBody.end(), hasContinue)) {
+                    e = program.makeExpr<DoWhile>(makeList(std::move(newBody)), negate(last->cmp));
+                }
+            }
+        }
+    } else if (auto* ifExpr = llvm::dyn_cast<IfExpr>(expr)) {
+        recoverLoops(ifExpr->trueList);
+        if (ifExpr->falseList) {
+            recoverLoops(ifExpr->falseList);
+        }
+    } else if (auto* switchExpr = llvm::dyn_cast<SwitchExpr>(expr)) {
+        for (auto& entry : switchExpr->cases) {
+            recoverLoops(entry.second);
+        }
+        recoverLoops(switchExpr->def);
+    } else if (auto* whileExpr = llvm::dyn_cast<WhileExpr>(expr)) {
+        recoverLoops(whileExpr->body);
+    } else if (auto* doWhile = llvm::dyn_cast<DoWhile>(expr)) {
+        recoverLoops(doWhile->body);
+    }
+}
+
+Expr* Structurer::structure(const llvm::Function& function) {
+    auto* body = makeList(emitNode(&function.getEntryBlock(), true));
+    removeUnusedLabels(body);
+    recoverLoops(body);
+    return body;
+}
+
+void structureControlFlow(const llvm::Module* module, Program& program) {
+    assert(program.isPassCompleted(PassType::CreateExpressions));
+    assert(program.isPassCompleted(PassType::ParseBreaks));
+
+    for (const llvm::Function& func : module->functions()) {
+        if (func.isDeclaration()) {
+            continue;
+        }
+
+        FunctionScope functionScope(program, func);
+        auto* function = program.getFunction(&func);
+
+        Structurer structurer(function, func);
+        auto* body = structurer.structure(func);
+
+        // the structured code of the whole function is written as the first block, other blocks are inside it
+        for (const auto& block : func) {
+            function->createBlockIfNotExist(&block)->doInline = true;
+        }
+
+        auto* entry = function->createBlockIfNotExist(&func.getEntryBlock());
+        entry->expressions = { body };
+        entry->doInline = false;
+        entry->isFirst = true;
+    }
+
+    program.addPass(PassType::StructureControlFlow);
+}
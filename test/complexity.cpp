@@ -0,0 +1,196 @@
+#include "../core/Program.h"
+#include "../parser/ProgramParser.h"
+
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/DerivedTypes.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include "llvm/Support/CommandLine.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Checks that a part of llvm2c scales linearly: the selected passes are run on a generated input
+ * of size n and 4n, and the ratio of their times must stay below the threshold (4 for linear, 16 for quadratic code).
+ */
+struct ComplexityCase {
+    std::string name;
+    std::vector<std::string> passes; // passes whose time is measured
+    std::function<std::unique_ptr<llvm::Module>(llvm::LLVMContext&, unsigned)> generate;
+};
+
+static llvm::Function* createMain(llvm::Module& mod) {
+    auto* i32 = llvm::Type::getInt32Ty(mod.getContext());
+    return llvm::Function::Create(llvm::FunctionType::get(i32, false), llvm::GlobalValue::ExternalLinkage, "main", &mod);
+}
+
+/**
+ * @brief deleteExprFromBlock: one block with @n allocas that are only stored to (removed by deleteUnusedVariables)
+ * and @n allocas that are read (moved to the beginning of the function by extractVars).
+ */
+static std::unique_ptr<llvm::Module> manyAllocas(llvm::LLVMContext& context, unsigned n) {
+    auto mod = std::make_unique<llvm::Module>("allocas", context);
+    llvm::IRBuilder<> builder(context);
+    auto* main = createMain(*mod);
+    builder.SetInsertPoint(llvm::BasicBlock::Create(context, "entry", main));
+
+    llvm::Value* sum = builder.getInt32(0);
+    for (unsigned i = 0; i < n; i++) {
+        auto* unused = builder.CreateAlloca(builder.getInt32Ty());
+        builder.CreateStore(builder.getInt32(i), unused);
+
+        auto* used = builder.CreateAlloca(builder.getInt32Ty());
+        builder.CreateStore(builder.getInt32(i), used);
+        sum = builder.CreateAdd(sum, builder.CreateLoad(builder.getInt32Ty(), used));
+    }
+    builder.CreateRet(sum);
+
+    return mod;
+}
+
+/**
+ * @brief canInline: one block with @n loads followed by @n additions using them,
+ * so that every load is separated from its only user by @n read-only instructions.
+ */
+static std::unique_ptr<llvm::Module> distantUses(llvm::LLVMContext& context, unsigned n) {
+    auto mod = std::make_unique<llvm::Module>("uses", context);
+    llvm::IRBuilder<> builder(context);
+    auto* global = new llvm::GlobalVariable(*mod, builder.getInt32Ty(), false, llvm::GlobalValue::ExternalLinkage, builder.getInt32(1), "g");
+    auto* main = createMain(*mod);
+    builder.SetInsertPoint(llvm::BasicBlock::Create(context, "entry", main));
+
+    std::vector<llvm::Value*> loads;
+    for (unsigned i = 0; i < n; i++) {
+        loads.push_back(builder.CreateLoad(builder.getInt32Ty(), global));
+    }
+
+    llvm::Value* sum = builder.getInt32(0);
+    for (auto* load : loads) {
+        sum = builder.CreateAdd(sum, load);
+    }
+    builder.CreateRet(sum);
+
+    return mod;
+}
+
+/**
+ * @brief Program::getStruct: @n named structs, each containing a pointer to the previous one, and a global variable of each.
+ */
+static std::unique_ptr<llvm::Module> manyStructs(llvm::LLVMContext& context, unsigned n) {
+    auto mod = std::make_unique<llvm::Module>("structs", context);
+    llvm::IRBuilder<> builder(context);
+
+    llvm::Type* previous = builder.getInt32Ty();
+    for (unsigned i = 0; i < n; i++) {
+        auto* strct = llvm::StructType::create(context, { builder.getInt32Ty(), previous->getPointerTo() }, "struct.s" + std::to_string(i));
+        new llvm::GlobalVariable(*mod, strct, false, llvm::GlobalValue::ExternalLinkage, llvm::Constant::getNullValue(strct), "g" + std::to_string(i));
+        previous = strct;
+    }
+
+    auto* main = createMain(*mod);
+    builder.SetInsertPoint(llvm::BasicBlock::Create(context, "entry", main));
+    builder.CreateRet(builder.getInt32(0));
+
+    return mod;
+}
+
+/**
+ * @brief Func::getVarName: @n global variables named like generated variables and a function with @n allocas,
+ * so that every generated name has to skip the names taken by the globals.
+ */
+static std::unique_ptr<llvm::Module> manyVarNames(llvm::LLVMContext& context, unsigned n) {
+    auto mod = std::make_unique<llvm::Module>("names", context);
+    llvm::IRBuilder<> builder(context);
+
+    for (unsigned i = 0; i < n; i++) {
+        new llvm::GlobalVariable(*mod, builder.getInt32Ty(), false, llvm::GlobalValue::ExternalLinkage, builder.getInt32(i), "var" + std::to_string(i * 2));
+    }
+
+    auto* main = createMain(*mod);
+    builder.SetInsertPoint(llvm::BasicBlock::Create(context, "entry", main));
+    llvm::Value* sum = builder.getInt32(0);
+    for (unsigned i = 0; i < n; i++) {
+        auto* var = builder.CreateAlloca(builder.getInt32Ty());
+        builder.CreateStore(builder.getInt32(i), var);
+        sum = builder.CreateAdd(sum, builder.CreateLoad(builder.getInt32Ty(), var));
+    }
+    builder.CreateRet(sum);
+
+    return mod;
+}
+
+/**
+ * @brief measure Returns the minimal time of the passes of @test over @repeat translations of an input of size @n.
+ */
+static double measure(const ComplexityCase& test, unsigned n, unsigned repeat) {
+    llvm::LLVMContext context;
+    auto mod = test.generate(context, n);
+
+    double best = 0;
+    for (unsigned i = 0; i < repeat; i++) {
+        ProgramParser parser(false);
+        auto program = parser.parse(mod.get());
+
+        double time = 0;
+        for (const auto& pass : parser.getPassTimes()) {
+            if (std::find(test.passes.begin(), test.passes.end(), pass.first) != test.passes.end()) {
+                time += pass.second;
+            }
+        }
+        best = i == 0 ? time : std::min(best, time);
+    }
+
+    return best;
+}
+
+int main(int argc, char** argv) {
+    llvm::cl::OptionCategory options("llvm2c-complexity options");
+    llvm::cl::list<std::string> Cases(llvm::cl::Positional, llvm::cl::desc("[cases]"), llvm::cl::cat(options));
+    llvm::cl::opt<unsigned> Size("n", llvm::cl::desc("Size of the smaller input"), llvm::cl::init(4000), llvm::cl::cat(options));
+    llvm::cl::opt<unsigned> Repeat("repeat", llvm::cl::desc("Number of translations of every input, the fastest one is used"), llvm::cl::init(3), llvm::cl::cat(options));
+    llvm::cl::opt<double> Threshold("threshold", llvm::cl::desc("Maximal allowed ratio of times for input of size 4n and n"), llvm::cl::init(8.0), llvm::cl::cat(options));
+
+    llvm::cl::HideUnrelatedOptions(options);
+    llvm::cl::ParseCommandLineOptions(argc, argv, "Checks that selected parts of llvm2c run in linear time.\n"
+                                                  "Runs all cases if none is given.\n");
+
+    std::vector<ComplexityCase> cases = {
+        { "deleteExprFromBlock", { "extractVars", "deleteUnusedVariables" }, manyAllocas },
+        { "canInline", { "createExpressions" }, distantUses },
+        { "getStruct", { "parseStructItems", "computeGlobalVarsOrder" }, manyStructs },
+        { "getVarName", { "createAllocas" }, manyVarNames },
+    };
+
+    int failed = 0;
+    unsigned run = 0;
+    for (const auto& test : cases) {
+        if (!Cases.empty() && std::find(Cases.begin(), Cases.end(), test.name) == Cases.end()) {
+            continue;
+        }
+        run++;
+
+        double small = measure(test, Size, Repeat);
+        double large = measure(test, Size * 4, Repeat);
+        double ratio = large / std::max(small, 1e-9);
+
+        bool ok = ratio <= Threshold;
+        printf("%-20s n: %8.3f ms, 4n: %8.3f ms, ratio: %6.2f [%s]\n", test.name.c_str(), small * 1000, large * 1000, ratio, ok ? "OK" : "NOK");
+        if (!ok) {
+            failed++;
+        }
+    }
+
+    if (run == 0) {
+        std::cerr << "No such case!\n";
+        return 1;
+    }
+
+    return failed ? 1 : 0;
+}
@@ -1,22 +1,139 @@
 #!/usr/bin/env python3
 
-num_tests = 1000
-csmith_runtime_dir = 'csmith-runtime'
+"""
+Generates random programs with csmith, translates them to LLVM with clang,
+back to C with llvm2c and compiles the result. The pipelines run in parallel,
+failures are grouped into buckets by their cause and slow translations are reported.
+"""
 
-import tempfile, os
-from subprocess import run, DEVNULL
+import argparse, json, os, random, re, shutil, statistics, time
+from concurrent.futures import ThreadPoolExecutor, as_completed
+from subprocess import run, PIPE, DEVNULL, TimeoutExpired
 
+csmith_runtime_dir = 'csmith-runtime'
 dirname = 'csmith-tests'
-for i in range(num_tests):
-    run(['./csmith', '--output', dirname + '/program.c'])
-    run(['clang', '-I', csmith_runtime_dir, '-S', '-emit-llvm', dirname + '/program.c'])
-    proc = run(['./llvm2c', '-o', dirname + '/output.c', dirname + '/program.ll'])
-
-    if proc.returncode != 0:
-        print("Found bug!")
-        break
-
-    proc = run(['clang', dirname + '/output.c'])
-    if proc.returncode != 0:
-        print("Found bug!")
-        break
+
+parser = argparse.ArgumentParser(description=__doc__)
+parser.add_argument('-n', '--num-tests', type=int, default=1000, help='number of generated programs')
+parser.add_argument('-j', '--jobs', type=int, default=os.cpu_count(), help='number of pipelines running at once')
+parser.add_argument('--seed', type=int, default=None, help='seed of the first program, the following ones are consecutive')
+parser.add_argument('--timeout', type=float, default=60, help='timeout of llvm2c in seconds')
+parser.add_argument('--slow-factor', type=float, default=10, help='translations slower than this multiple of the median are reported')
+parser.add_argument('--keep', type=int, default=3, help='number of kept example programs per failure bucket')
+args = parser.parse_args()
+
+
+def signature(proc):
+    """Returns the bucket of a failed llvm2c run: the assertion message, the error message or the pass that crashed."""
+    assertion = re.search(r"Assertion `(.*)' failed", proc.stderr)
+    if assertion:
+        return 'assertion: ' + assertion.group(1)
+
+    passes = re.findall(r'Starting pass: (\w+)', proc.stdout)
+    last_pass = passes[-1] if passes else 'loading'
+
+    lines = [l for l in proc.stderr.splitlines() if l.strip() and not l.startswith(('Parser start', 'Stack dump', ' #'))]
+    if proc.returncode > 0 and lines:
+        return 'error: ' + lines[-1].strip()
+
+    return 'crash in %s (exit code %d)' % (last_pass, proc.returncode)
+
+
+def compile_signature(proc):
+    errors = [l for l in proc.stderr.splitlines() if 'error:' in l]
+    if not errors:
+        return 'clang failed to compile the output'
+    # strip the file name and position, so that the same error in different programs ends in one bucket
+    return 'clang: ' + re.sub(r'^.*?error: ', '', errors[0])
+
+
+def test(seed):
+    workdir = os.path.join(dirname, str(seed))
+    os.makedirs(workdir, exist_ok=True)
+    program = os.path.join(workdir, 'program.c')
+    ll = os.path.join(workdir, 'program.ll')
+    output = os.path.join(workdir, 'output.c')
+    result = {'seed': seed, 'bucket': None, 'time': None}
+
+    try:
+        if run(['./csmith', '--seed', str(seed), '--output', program], stdout=DEVNULL).returncode != 0:
+            result['bucket'] = 'csmith failed'
+            return result
+        if run(['clang', '-I', csmith_runtime_dir, '-S', '-emit-llvm', '-w', program, '-o', ll], stdout=DEVNULL, stderr=DEVNULL).returncode != 0:
+            result['bucket'] = 'clang failed to compile the generated program'
+            return result
+
+        start = time.monotonic()
+        try:
+            proc = run(['./llvm2c', '-o', output, ll], stdout=PIPE, stderr=PIPE, universal_newlines=True, errors='replace', timeout=args.timeout)
+        except TimeoutExpired:
+            result['bucket'] = 'llvm2c timeout'
+            return result
+        result['time'] = time.monotonic() - start
+
+        if proc.returncode != 0:
+            result['bucket'] = signature(proc)
+            return result
+
+        proc = run(['clang', '-I', csmith_runtime_dir, '-w', '-c', output, '-o', os.devnull], stdout=DEVNULL, stderr=PIPE, universal_newlines=True, errors='replace')
+        if proc.returncode != 0:
+            result['bucket'] = compile_signature(proc)
+        return result
+    finally:
+        result['program'] = program
+        result['size'] = os.path.getsize(ll) if os.path.exists(ll) else 0
+
+
+def main():
+    os.makedirs(dirname, exist_ok=True)
+    first_seed = args.seed if args.seed is not None else random.randrange(2 ** 31)
+
+    buckets = {}
+    results = []
+    with ThreadPoolExecutor(max_workers=args.jobs) as pool:
+        futures = [pool.submit(test, first_seed + i) for i in range(args.num_tests)]
+        for done, future in enumerate(as_completed(futures), 1):
+            result = future.result()
+            results.append(result)
+            workdir = os.path.dirname(result['program'])
+
+            if result['bucket'] is None:
+                continue
+
+            bucket = buckets.setdefault(result['bucket'], [])
+            bucket.append(result['seed'])
+            if len(bucket) > args.keep:
+                shutil.rmtree(workdir, ignore_errors=True)
+            if len(bucket) == 1:
+                print('[%d/%d] new bucket (seed %d): %s' % (done, args.num_tests, result['seed'], result['bucket']), flush=True)
+
+    times = [r['time'] for r in results if r['time'] is not None]
+    median = statistics.median(times) if times else 0
+    slow = sorted((r for r in results if r['time'] is not None and median > 0 and r['time'] > median * args.slow_factor),
+                  key=lambda r: r['time'], reverse=True)
+
+    print('\n%d programs, %d failed in %d buckets' % (len(results), sum(len(b) for b in buckets.values()), len(buckets)))
+    for name, seeds in sorted(buckets.items(), key=lambda b: len(b[1]), reverse=True):
+        print('  %5d  %s (seeds %s)' % (len(seeds), name, ', '.join(map(str, seeds[:args.keep]))))
+
+    if times:
+        print('\ntranslation time: median %.3fs, max %.3fs' % (median, max(times)))
+    for r in slow:
+        print('  slow: seed %d took %.3fs (%.1fx median, %d bytes of LLVM)' % (r['seed'], r['time'], r['time'] / median, r['size']))
+
+    # programs that passed are kept only if they are slow, for profiling
+    slow_seeds = set(r['seed'] for r in slow)
+    for r in results:
+        if r['bucket'] is None and r['seed'] not in slow_seeds:
+            shutil.rmtree(os.path.dirname(r['program']), ignore_errors=True)
+
+    with open(os.path.join(dirname, 'summary.json'), 'w') as f:
+        json.dump({'first_seed': first_seed, 'buckets': buckets,
+                   'times': {r['seed']: r['time'] for r in results if r['time'] is not None},
+                   'slow': [r['seed'] for r in slow]}, f, indent=2)
+
+    return 1 if buckets or slow else 0
+
+
+if __name__ == '__main__':
+    exit(main())
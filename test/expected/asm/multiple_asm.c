@@ -19,12 +19,12 @@ int main(int var0, char** var1){
         return var2;
     } else {
         l = strtol(*(((unsigned char**)(argv)) + 1), &p, 10);
-        if (((int)(*p)) != 0) {
+        if (((int)((char)(*p))) != 0) {
             var2 = -1;
             return var2;
         } else {
             r = strtol(*(((unsigned char**)(argv)) + 2), &p, 10);
-            if (((int)(*p)) != 0) {
+            if (((int)((char)(*p))) != 0) {
                 var2 = -1;
                 return var2;
             } else {
@@ -0,0 +1,28 @@
+// function declarations
+extern unsigned int atoi(unsigned char* var0);
+int main(int var0, char** var1);
+
+int main(int var0, char** var1){
+    unsigned int var2;
+    block0:
+    var2 = atoi(*(((unsigned char**)(var1)) + 1));
+    if (__builtin_expect(((int)var2) > ((int)0), 1)) {
+        return var2 << 1;
+    } else {
+        switch ((unsigned int)__builtin_expect((unsigned int)__builtin_expect((long)((int)var2), -3), 4294967293u)) {
+            case -3:
+                return 13;
+            case -7:
+                return 17;
+            case -1:
+                return 11;
+            default:
+                if (__builtin_expect(var2 == 0, 0)) {
+                    return 19;
+                } else {
+                    return 0 - var2;
+                }
+}
+    }
+}
+
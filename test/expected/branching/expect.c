@@ -0,0 +1,43 @@
+// function declarations
+int main(int var0, char** var1);
+extern unsigned long strtol(unsigned char* var0, unsigned char** var1, unsigned int var2);
+
+int main(int var0, char** var1){
+    unsigned int var2;
+    unsigned int argc;
+    unsigned char** argv;
+    unsigned char* p;
+    unsigned long num;
+    block0:
+    var2 = 0;
+    argc = var0;
+    argv = var1;
+    if (argc != 2) {
+        var2 = -1;
+        return var2;
+    } else {
+        num = strtol(*(((unsigned char**)(argv)) + 1), &p, 10);
+        if (((long)((int)(((int)((char)(*p))) != 0))) != 0) {
+            var2 = -1;
+            return var2;
+        } else {
+            if (((long)((int)(((long)num) > ((long)0)))) != 0) {
+                var2 = ((unsigned int)(((long)num) * ((long)2)));
+                return var2;
+            } else {
+                switch (num) {
+                    case -2:
+                        var2 = 9;
+                        return var2;
+                    case -1:
+                        var2 = 7;
+                        return var2;
+                    default:
+                        var2 = 1;
+                        return var2;
+}
+            }
+        }
+    }
+}
+
@@ -0,0 +1,50 @@
+// function declarations
+extern unsigned int atoi(unsigned char* var0);
+int main(int var0, char** var1);
+
+int main(int var0, char** var1){
+    unsigned int var2;
+    unsigned int var3_phi;
+    unsigned int var4_phi;
+    unsigned int var7_phi;
+    unsigned int var8_phi;
+    unsigned int var11_phi;
+    unsigned int var5;
+    unsigned int var6;
+    unsigned int var9;
+    unsigned int var10;
+    block0:
+    var2 = atoi(*(((unsigned char**)(var1)) + 1));
+    if ((var2 & 1) == 0) {
+        var3_phi = var2;
+        var4_phi = 0;
+        goto block1;
+    } else {
+        var7_phi = var2;
+        var8_phi = 1;
+        goto block2;
+    }
+    block1:
+    var5 = (var3_phi + 3);
+    var6 = (var4_phi + var5);
+    if (((int)var5) < ((int)40)) {
+        var7_phi = var5;
+        var8_phi = var6;
+        goto block2;
+    } else {
+        var11_phi = var6;
+        return var11_phi & 127;
+    }
+    block2:
+    var9 = (var8_phi * 3);
+    var10 = (var7_phi + 5);
+    if (((int)var10) < ((int)30)) {
+        var3_phi = var10;
+        var4_phi = var9;
+        goto block1;
+    } else {
+        var11_phi = var9;
+        return var11_phi & 127;
+    }
+}
+
@@ -0,0 +1,68 @@
+// struct declarations
+struct s_Block;
+
+// struct definitions
+struct s_Block {
+    unsigned int structVar0[4];
+};
+
+// function declarations
+extern unsigned int atoi(unsigned char* var0);
+int main(int var0, char** var1);
+unsigned int sum(struct s_Block* var0);
+
+// global variable definitions
+float table[8] __attribute__((aligned(32))) = {1.0,2.0,3.0,4.0,5.0,6.0,7.0,8.0,};
+
+int main(int var0, char** var1){
+    unsigned int var2;
+    unsigned int argc;
+    unsigned char** argv;
+    unsigned int n;
+    struct s_Block block __attribute__((aligned(64)));
+    unsigned int i;
+    unsigned int result;
+    block0:
+    var2 = 0;
+    argc = var0;
+    argv = var1;
+    if (argc != 2) {
+        var2 = -1;
+        return var2;
+    } else {
+        n = atoi(*(((unsigned char**)(argv)) + 1));
+        i = 0;
+        goto block3;
+    }
+    block3:
+    if (((int)i) < ((int)4)) {
+        ((block.structVar0)[(long)((int)i)]) = (((int)n) + ((int)i));
+        i = (((int)i) + ((int)1));
+        goto block3;
+    } else {
+        result = (((int)sum(&block)) + ((int)(table[(long)((int)(n & 7))])));
+        if ((((unsigned long)(&block)) % 64) != 0) {
+            goto block8;
+        } else {
+            if ((((unsigned long)(&table)) % 32) != 0) {
+                goto block8;
+            } else {
+                goto block9;
+            }
+        }
+    }
+    block8:
+    result = 0;
+    goto block9;
+    block9:
+    var2 = (result & 127);
+    return var2;
+}
+
+unsigned int sum(struct s_Block* var0){
+    struct s_Block* block;
+    block0:
+    block = var0;
+    return ((int)(((int)(((int)(*((unsigned int*)__builtin_assume_aligned(&((block->structVar0)[0]), 16)))) + ((int)((block->structVar0)[1])))) + ((int)(*((unsigned int*)__builtin_assume_aligned(&((block->structVar0)[2]), 8)))))) + ((int)((block->structVar0)[3]));
+}
+
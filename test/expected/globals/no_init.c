@@ -17,7 +17,7 @@ struct s_parent {
 int main(int var0, char** var1);
 
 // global variable definitions
-struct s_parent p = {{0,0,},0,0,};
+struct s_parent p = {0};
 
 int main(int var0, char** var1){
     unsigned int var2;
@@ -18,7 +18,7 @@ int main(int var0, char** var1){
         return var2;
     } else {
         num = strtol(*(((unsigned char**)(argv)) + 1), &p, 10);
-        if (((int)(*p)) != 0) {
+        if (((int)((char)(*p))) != 0) {
             var2 = -1;
             return var2;
         } else {
@@ -27,7 +27,7 @@ int main(int var0, char** var1){
         }
     }
     block5:
-    num = (((long)num) + ((long)i));
+    num = (((long)num) + ((long)((int)i)));
     i = (((int)i) + ((int)1));
     if (((int)i) < ((int)10)) {
         goto block5;
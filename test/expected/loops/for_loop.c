@@ -19,7 +19,7 @@ int main(int var0, char** var1){
         return var2;
     } else {
         num = strtol(*(((unsigned char**)(argv)) + 1), &p, 10);
-        if (((int)(*p)) != 0) {
+        if (((int)((char)(*p))) != 0) {
             var2 = -1;
             return var2;
         } else {
@@ -29,7 +29,7 @@ int main(int var0, char** var1){
         }
     }
     block5:
-    if (((long)i) < ((long)num)) {
+    if (((long)((int)i)) < ((long)num)) {
         test = (((int)test) + ((int)i));
         i = (((int)i) + ((int)1));
         goto block5;
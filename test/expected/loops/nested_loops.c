@@ -19,7 +19,7 @@ int main(int var0, char** var1){
         return var2;
     } else {
         num = strtol(*(((unsigned char**)(argv)) + 1), &p, 10);
-        if (((int)(*p)) != 0) {
+        if (((int)((char)(*p))) != 0) {
             var2 = -1;
             return var2;
         } else {
@@ -36,8 +36,8 @@ int main(int var0, char** var1){
         return var2;
     }
     block7:
-    if (((int)j) < ((int)(i + 10))) {
-        num = (((long)(((long)num) + ((long)j))) - ((long)i));
+    if (((int)j) < ((int)(((int)i) + ((int)10)))) {
+        num = (((long)(((long)num) + ((long)((int)j)))) - ((long)((int)i)));
         j = (((int)j) + ((int)1));
         goto block7;
     } else {
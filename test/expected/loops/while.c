@@ -18,7 +18,7 @@ int main(int var0, char** var1){
         return var2;
     } else {
         num = strtol(*(((unsigned char**)(argv)) + 1), &p, 10);
-        if (((int)(*p)) != 0) {
+        if (((int)((char)(*p))) != 0) {
             var2 = -1;
             return var2;
         } else {
@@ -28,7 +28,7 @@ int main(int var0, char** var1){
     }
     block5:
     if (((int)test) < ((int)10)) {
-        num = (((long)num) - ((long)test));
+        num = (((long)num) - ((long)((int)test)));
         test = (((int)test) + ((int)1));
         goto block5;
     } else {
@@ -3,7 +3,7 @@ int main(int var0, char** var1);
 extern unsigned int printf(unsigned char* var0, ...);
 
 // global variable definitions
-unsigned char _str[14] = {72,101,108,108,111,32,119,111,114,108,100,33,10,0,};
+unsigned char _str[14] = "Hello world!\n";
 
 int main(int var0, char** var1){
     unsigned int var2;
@@ -3,7 +3,7 @@ void main(void);
 extern unsigned int printf(unsigned char* var0, ...);
 
 // global variable definitions
-unsigned char _str[15] = {72,101,108,108,111,44,32,119,111,114,108,100,33,10,0,};
+unsigned char _str[15] = "Hello, world!\n";
 
 void main(void){
     block0:
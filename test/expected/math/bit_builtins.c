@@ -0,0 +1,85 @@
+// anonymous struct declarations
+struct anonymous_struct0;
+
+// struct definitions
+struct anonymous_struct0 {
+    unsigned int structVar0;
+    unsigned int structVar1;
+};
+
+// function declarations
+extern int abs(int var0);
+extern unsigned int atoi(unsigned char* var0);
+extern long labs(long var0);
+extern unsigned int llvm_bswap_i32(unsigned int var0);
+extern unsigned int llvm_ctlz_i32(unsigned int var0, unsigned int var1);
+extern unsigned int llvm_ctpop_i32(unsigned int var0);
+extern unsigned long llvm_ctpop_i64(unsigned long var0);
+extern unsigned int llvm_cttz_i32(unsigned int var0, unsigned int var1);
+extern unsigned long llvm_cttz_i64(unsigned long var0, unsigned int var1);
+extern struct anonymous_struct0 llvm_sadd_with_overflow_i32(unsigned int var0, unsigned int var1);
+extern struct anonymous_struct0 llvm_umul_with_overflow_i32(unsigned int var0, unsigned int var1);
+int main(int var0, char** var1);
+
+int main(int var0, char** var1){
+    unsigned int var2;
+    unsigned int argc;
+    unsigned char** argv;
+    unsigned int n;
+    int x;
+    long y;
+    unsigned int result;
+    unsigned int sum;
+    int product;
+    unsigned int var11;
+    unsigned int var12;
+    unsigned int var13;
+    long var14;
+    struct anonymous_struct0 var15;
+    unsigned int var16;
+    struct anonymous_struct0 var17;
+    unsigned int var18;
+    block0:
+    var2 = 0;
+    argc = var0;
+    argv = var1;
+    if (argc != 2) {
+        var2 = -1;
+        return var2;
+    } else {
+        n = atoi(*(((unsigned char**)(argv)) + 1));
+        x = (n * -1640531535);
+        y = ((((unsigned long)((unsigned int)x)) << 20) | 1);
+        var11 = __builtin_popcount((unsigned int)x);
+        result = (((int)var11) + ((int)__builtin_popcountl((unsigned long)y)));
+        var12 = __builtin_clz((unsigned int)(x | 1));
+        var13 = (((int)var12) + ((int)__builtin_ctz((unsigned int)(x | -2147483648))));
+        result = (((int)result) + ((int)(((int)var13) + ((int)__builtin_ctzl((unsigned long)y)))));
+        result = (result + ((__builtin_bswap32((unsigned int)x)) >> (28)));
+        var14 = ((long)((int)abs(n)));
+        result = ((unsigned int)(((long)((int)result)) + (var14 + ((long)labs(((long)((int)n)) * ((long)3))))));
+        (var15.structVar1) = __builtin_add_overflow((int)n, (int)2147483640, (int*)(&(var15.structVar0)));
+        var16 = (var15.structVar1);
+        sum = (var15.structVar0);
+        if (var16) {
+            result = (((int)result) + ((int)1));
+            goto block4;
+        } else {
+            goto block4;
+        }
+    }
+    block4:
+    (var17.structVar1) = __builtin_mul_overflow((unsigned int)x, (unsigned int)3, &(var17.structVar0));
+    var18 = (var17.structVar1);
+    product = (var17.structVar0);
+    if (var18) {
+        result = (((int)result) + ((int)2));
+        goto block6;
+    } else {
+        goto block6;
+    }
+    block6:
+    var2 = (result & 127);
+    return var2;
+}
+
@@ -14,7 +14,7 @@ unsigned long fact(unsigned long var0){
     goto block1;
     block1:
     if (((long)l) <= ((long)num)) {
-        result = (result * l);
+        result = (((unsigned long)result) * l);
         l = (((long)l) + ((long)1));
         goto block1;
     } else {
@@ -37,7 +37,7 @@ int main(int var0, char** var1){
         return var2;
     } else {
         num = strtol(*(((unsigned char**)(argv)) + 1), &p, 10);
-        if (((int)(*p)) != 0) {
+        if (((int)((char)(*p))) != 0) {
             var2 = -1;
             return var2;
         } else {
@@ -0,0 +1,64 @@
+// function declarations
+extern unsigned int atoi(unsigned char* var0);
+int main(int var0, char** var1);
+double next(double var0);
+
+// global variable definitions
+unsigned int calls = 0;
+
+int main(int var0, char** var1){
+    unsigned int var2;
+    unsigned int argc;
+    unsigned char** argv;
+    double n;
+    unsigned int result;
+    double var7;
+    double var8;
+    double var9;
+    block0:
+    var2 = 0;
+    argc = var0;
+    argv = var1;
+    if (argc != 2) {
+        var2 = -1;
+        return var2;
+    } else {
+        n = ((double)atoi(*(((unsigned char**)(argv)) + 1)));
+        result = 0;
+        var7 = next(n);
+        if (!(var7 == var7)) {
+            result = (((int)result) + ((int)1));
+            goto block4;
+        } else {
+            goto block4;
+        }
+    }
+    block4:
+    var8 = next(n);
+    if ((var8 < 1.0E+0) || (var8 > 1.0E+0)) {
+        result = (((int)result) + ((int)2));
+        goto block6;
+    } else {
+        goto block6;
+    }
+    block6:
+    var9 = next(n);
+    if ((var9 < 0.0E+0) || (var9 > 0.0E+0)) {
+        goto block8;
+    } else {
+        result = (((int)result) + ((int)4));
+        goto block8;
+    }
+    block8:
+    var2 = (((int)result) + ((int)(((int)8) * ((int)calls))));
+    return var2;
+}
+
+double next(double var0){
+    double x;
+    block0:
+    x = var0;
+    calls = (((int)calls) + ((int)1));
+    return x / 2.0E+0;
+}
+
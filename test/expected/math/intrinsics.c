@@ -0,0 +1,538 @@
+// function declarations
+extern unsigned int atoi(unsigned char* var0);
+extern unsigned short llvm_abs_i16(unsigned short var0, unsigned int var1);
+extern unsigned int llvm_abs_i32(unsigned int var0, unsigned int var1);
+extern unsigned long llvm_abs_i64(unsigned long var0, unsigned int var1);
+extern unsigned char llvm_abs_i8(unsigned char var0, unsigned int var1);
+extern unsigned short llvm_bswap_i16(unsigned short var0);
+extern unsigned int llvm_bswap_i32(unsigned int var0);
+extern unsigned long llvm_bswap_i64(unsigned long var0);
+extern unsigned short llvm_ctlz_i16(unsigned short var0, unsigned int var1);
+extern unsigned int llvm_ctlz_i32(unsigned int var0, unsigned int var1);
+extern unsigned long llvm_ctlz_i64(unsigned long var0, unsigned int var1);
+extern unsigned char llvm_ctlz_i8(unsigned char var0, unsigned int var1);
+extern unsigned short llvm_ctpop_i16(unsigned short var0);
+extern unsigned int llvm_ctpop_i32(unsigned int var0);
+extern unsigned long llvm_ctpop_i64(unsigned long var0);
+extern unsigned char llvm_ctpop_i8(unsigned char var0);
+extern unsigned short llvm_cttz_i16(unsigned short var0, unsigned int var1);
+extern unsigned int llvm_cttz_i32(unsigned int var0, unsigned int var1);
+extern unsigned long llvm_cttz_i64(unsigned long var0, unsigned int var1);
+extern unsigned char llvm_cttz_i8(unsigned char var0, unsigned int var1);
+extern unsigned short llvm_fshl_i16(unsigned short var0, unsigned short var1, unsigned short var2);
+extern unsigned int llvm_fshl_i32(unsigned int var0, unsigned int var1, unsigned int var2);
+extern unsigned long llvm_fshl_i64(unsigned long var0, unsigned long var1, unsigned long var2);
+extern unsigned char llvm_fshl_i8(unsigned char var0, unsigned char var1, unsigned char var2);
+extern unsigned short llvm_fshr_i16(unsigned short var0, unsigned short var1, unsigned short var2);
+extern unsigned int llvm_fshr_i32(unsigned int var0, unsigned int var1, unsigned int var2);
+extern unsigned long llvm_fshr_i64(unsigned long var0, unsigned long var1, unsigned long var2);
+extern unsigned char llvm_fshr_i8(unsigned char var0, unsigned char var1, unsigned char var2);
+extern unsigned short llvm_smax_i16(unsigned short var0, unsigned short var1);
+extern unsigned int llvm_smax_i32(unsigned int var0, unsigned int var1);
+extern unsigned long llvm_smax_i64(unsigned long var0, unsigned long var1);
+extern unsigned char llvm_smax_i8(unsigned char var0, unsigned char var1);
+extern unsigned short llvm_smin_i16(unsigned short var0, unsigned short var1);
+extern unsigned int llvm_smin_i32(unsigned int var0, unsigned int var1);
+extern unsigned long llvm_smin_i64(unsigned long var0, unsigned long var1);
+extern unsigned char llvm_smin_i8(unsigned char var0, unsigned char var1);
+extern unsigned short llvm_umax_i16(unsigned short var0, unsigned short var1);
+extern unsigned int llvm_umax_i32(unsigned int var0, unsigned int var1);
+extern unsigned long llvm_umax_i64(unsigned long var0, unsigned long var1);
+extern unsigned char llvm_umax_i8(unsigned char var0, unsigned char var1);
+extern unsigned short llvm_umin_i16(unsigned short var0, unsigned short var1);
+extern unsigned int llvm_umin_i32(unsigned int var0, unsigned int var1);
+extern unsigned long llvm_umin_i64(unsigned long var0, unsigned long var1);
+extern unsigned char llvm_umin_i8(unsigned char var0, unsigned char var1);
+int main(int var0, char** var1);
+
+int main(int var0, char** var1){
+    long var2;
+    long var3;
+    unsigned char var4;
+    unsigned char var5;
+    unsigned char var6;
+    unsigned char var7;
+    unsigned char var8;
+    long var9;
+    unsigned char var10;
+    long var11;
+    unsigned char var12;
+    long var13;
+    unsigned char var14;
+    long var15;
+    unsigned char var16;
+    long var17;
+    unsigned char var18;
+    long var19;
+    unsigned char var20;
+    long var21;
+    unsigned char var22;
+    long var23;
+    unsigned char var24;
+    long var25;
+    unsigned char var26;
+    long var27;
+    unsigned char var28;
+    long var29;
+    unsigned char var30;
+    long var31;
+    unsigned char var32;
+    long var33;
+    unsigned char var34;
+    long var35;
+    unsigned char var36;
+    long var37;
+    unsigned char var38;
+    long var39;
+    unsigned char var40;
+    long var41;
+    unsigned char var42;
+    long var43;
+    unsigned char var44;
+    long var45;
+    unsigned char var46;
+    long var47;
+    unsigned char var48;
+    long var49;
+    unsigned char var50;
+    long var51;
+    unsigned char var52;
+    long var53;
+    unsigned char var54;
+    long var55;
+    unsigned char var56;
+    long var57;
+    unsigned char var58;
+    long var59;
+    unsigned char var60;
+    long var61;
+    unsigned char var62;
+    long var63;
+    unsigned char var64;
+    long var65;
+    unsigned char var66;
+    long var67;
+    unsigned short var68;
+    unsigned short var69;
+    unsigned short var70;
+    unsigned short var71;
+    unsigned short var72;
+    long var73;
+    unsigned short var74;
+    long var75;
+    unsigned short var76;
+    long var77;
+    unsigned short var78;
+    long var79;
+    unsigned short var80;
+    long var81;
+    unsigned short var82;
+    long var83;
+    unsigned short var84;
+    long var85;
+    unsigned short var86;
+    long var87;
+    unsigned short var88;
+    long var89;
+    unsigned short var90;
+    long var91;
+    unsigned short var92;
+    long var93;
+    unsigned short var94;
+    long var95;
+    unsigned short var96;
+    long var97;
+    unsigned short var98;
+    long var99;
+    unsigned short var100;
+    long var101;
+    unsigned short var102;
+    long var103;
+    unsigned short var104;
+    long var105;
+    unsigned short var106;
+    long var107;
+    unsigned short var108;
+    long var109;
+    unsigned short var110;
+    long var111;
+    unsigned short var112;
+    long var113;
+    unsigned short var114;
+    long var115;
+    unsigned short var116;
+    long var117;
+    unsigned short var118;
+    long var119;
+    unsigned short var120;
+    long var121;
+    unsigned short var122;
+    long var123;
+    unsigned short var124;
+    long var125;
+    unsigned short var126;
+    long var127;
+    unsigned short var128;
+    long var129;
+    unsigned short var130;
+    long var131;
+    unsigned short var132;
+    long var133;
+    unsigned short var134;
+    long var135;
+    unsigned short var136;
+    long var137;
+    unsigned int var138;
+    unsigned int var139;
+    unsigned int var140;
+    unsigned int var141;
+    unsigned int var142;
+    long var143;
+    unsigned int var144;
+    long var145;
+    unsigned int var146;
+    long var147;
+    unsigned int var148;
+    long var149;
+    unsigned int var150;
+    long var151;
+    unsigned int var152;
+    long var153;
+    unsigned int var154;
+    long var155;
+    unsigned int var156;
+    long var157;
+    unsigned int var158;
+    long var159;
+    unsigned int var160;
+    long var161;
+    unsigned int var162;
+    long var163;
+    unsigned int var164;
+    long var165;
+    unsigned int var166;
+    long var167;
+    unsigned int var168;
+    long var169;
+    unsigned int var170;
+    long var171;
+    unsigned int var172;
+    long var173;
+    unsigned int var174;
+    long var175;
+    unsigned int var176;
+    long var177;
+    unsigned int var178;
+    long var179;
+    unsigned int var180;
+    long var181;
+    unsigned int var182;
+    long var183;
+    unsigned int var184;
+    long var185;
+    unsigned int var186;
+    long var187;
+    unsigned int var188;
+    long var189;
+    unsigned int var190;
+    long var191;
+    unsigned int var192;
+    long var193;
+    unsigned int var194;
+    long var195;
+    unsigned int var196;
+    long var197;
+    unsigned int var198;
+    long var199;
+    unsigned int var200;
+    long var201;
+    unsigned int var202;
+    long var203;
+    unsigned int var204;
+    long var205;
+    unsigned int var206;
+    long var207;
+    long var208;
+    long var209;
+    long var210;
+    long var211;
+    long var212;
+    long var213;
+    long var214;
+    long var215;
+    long var216;
+    long var217;
+    long var218;
+    long var219;
+    long var220;
+    long var221;
+    long var222;
+    long var223;
+    long var224;
+    long var225;
+    long var226;
+    long var227;
+    long var228;
+    long var229;
+    long var230;
+    long var231;
+    long var232;
+    long var233;
+    long var234;
+    long var235;
+    long var236;
+    long var237;
+    long var238;
+    long var239;
+    long var240;
+    long var241;
+    long var242;
+    long var243;
+    long var244;
+    block0:
+    var2 = ((long)((int)atoi(*(((unsigned char**)(var1)) + 1))));
+    var3 = (((unsigned long)var2) + 0);
+    var4 = ((unsigned char)var2);
+    var5 = (var4 * -99);
+    var6 = (var4 + 3);
+    var7 = (var6 | 1);
+    var8 = __builtin_popcount((unsigned char)var4);
+    var9 = ((((unsigned long)((((unsigned long)var3) * 31) ^ ((unsigned long)var8))) * 31) ^ ((long)((char)var8)));
+    var10 = (((unsigned char)var4) ? (__builtin_clz((unsigned char)var4) - 24) : 8);
+    var11 = ((((unsigned long)((((unsigned long)var9) * 31) ^ ((unsigned long)var10))) * 31) ^ ((long)((char)var10)));
+    var12 = (((unsigned char)var4) ? __builtin_ctz((unsigned char)var4) : 8);
+    var13 = ((((unsigned long)((((unsigned long)var11) * 31) ^ ((unsigned long)var12))) * 31) ^ ((long)((char)var12)));
+    var14 = __builtin_abs((char)var4);
+    var15 = ((((unsigned long)((((unsigned long)var13) * 31) ^ ((unsigned long)var14))) * 31) ^ ((long)((char)var14)));
+    var16 = __builtin_popcount((unsigned char)var5);
+    var17 = ((((unsigned long)((((unsigned long)var15) * 31) ^ ((unsigned long)var16))) * 31) ^ ((long)((char)var16)));
+    var18 = (((unsigned char)var5) ? (__builtin_clz((unsigned char)var5) - 24) : 8);
+    var19 = ((((unsigned long)((((unsigned long)var17) * 31) ^ ((unsigned long)var18))) * 31) ^ ((long)((char)var18)));
+    var20 = (((unsigned char)var5) ? __builtin_ctz((unsigned char)var5) : 8);
+    var21 = ((((unsigned long)((((unsigned long)var19) * 31) ^ ((unsigned long)var20))) * 31) ^ ((long)((char)var20)));
+    var22 = __builtin_abs((char)var5);
+    var23 = ((((unsigned long)((((unsigned long)var21) * 31) ^ ((unsigned long)var22))) * 31) ^ ((long)((char)var22)));
+    var24 = __builtin_popcount((unsigned char)-127);
+    var25 = ((((unsigned long)((((unsigned long)var23) * 31) ^ ((unsigned long)var24))) * 31) ^ ((long)((char)var24)));
+    var26 = (((unsigned char)-127) ? (__builtin_clz((unsigned char)-127) - 24) : 8);
+    var27 = ((((unsigned long)((((unsigned long)var25) * 31) ^ ((unsigned long)var26))) * 31) ^ ((long)((char)var26)));
+    var28 = (((unsigned char)-127) ? __builtin_ctz((unsigned char)-127) : 8);
+    var29 = ((((unsigned long)((((unsigned long)var27) * 31) ^ ((unsigned long)var28))) * 31) ^ ((long)((char)var28)));
+    var30 = __builtin_abs((char)-127);
+    var31 = ((((unsigned long)((((unsigned long)var29) * 31) ^ ((unsigned long)var30))) * 31) ^ ((long)((char)var30)));
+    var32 = (__builtin_clz((unsigned char)var7) - 24);
+    var33 = ((((unsigned long)((((unsigned long)var31) * 31) ^ ((unsigned long)var32))) * 31) ^ ((long)((char)var32)));
+    var34 = __builtin_abs((char)var5);
+    var35 = ((((unsigned long)((((unsigned long)var33) * 31) ^ ((unsigned long)var34))) * 31) ^ ((long)((char)var34)));
+    var36 = ((unsigned char)(((((unsigned char)var4) << 3) | (((unsigned char)var5) >> (5))) & 255));
+    var37 = ((((unsigned long)((((unsigned long)var35) * 31) ^ ((unsigned long)var36))) * 31) ^ ((long)((char)var36)));
+    var38 = ((unsigned char)(((((unsigned char)var5) << (((unsigned char)var6) & 7)) | (((unsigned char)var5) >> ((-((unsigned char)var6)) & 7))) & 255));
+    var39 = ((((unsigned long)((((unsigned long)var37) * 31) ^ ((unsigned long)var38))) * 31) ^ ((long)((char)var38)));
+    var40 = ((unsigned char)(((((unsigned char)-127) << 1) | (((unsigned char)-127) >> (7))) & 255));
+    var41 = ((((unsigned long)((((unsigned long)var39) * 31) ^ ((unsigned long)var40))) * 31) ^ ((long)((char)var40)));
+    var42 = ((unsigned char)(((((unsigned char)var4) << (((unsigned char)var6) & 7)) | ((((unsigned char)-127) >> (1)) >> (7 - (((unsigned char)var6) & 7)))) & 255));
+    var43 = ((((unsigned long)((((unsigned long)var41) * 31) ^ ((unsigned long)var42))) * 31) ^ ((long)((char)var42)));
+    var44 = ((unsigned char)(((((unsigned char)var4) << 5) | (((unsigned char)var5) >> (3))) & 255));
+    var45 = ((((unsigned long)((((unsigned long)var43) * 31) ^ ((unsigned long)var44))) * 31) ^ ((long)((char)var44)));
+    var46 = ((unsigned char)(((((unsigned char)var5) << ((-((unsigned char)var6)) & 7)) | (((unsigned char)var5) >> (((unsigned char)var6) & 7))) & 255));
+    var47 = ((((unsigned long)((((unsigned long)var45) * 31) ^ ((unsigned long)var46))) * 31) ^ ((long)((char)var46)));
+    var48 = ((unsigned char)(((((unsigned char)-127) << 7) | (((unsigned char)-127) >> (1))) & 255));
+    var49 = ((((unsigned long)((((unsigned long)var47) * 31) ^ ((unsigned long)var48))) * 31) ^ ((long)((char)var48)));
+    var50 = ((unsigned char)((((((unsigned char)var4) << 1) << (7 - (((unsigned char)var6) & 7))) | (((unsigned char)-127) >> (((unsigned char)var6) & 7))) & 255));
+    var51 = ((((unsigned long)((((unsigned long)var49) * 31) ^ ((unsigned long)var50))) * 31) ^ ((long)((char)var50)));
+    var52 = ((((char)var4) < ((char)var5)) ? ((unsigned char)var4) : ((unsigned char)var5));
+    var53 = ((((unsigned long)((((unsigned long)var51) * 31) ^ ((unsigned long)var52))) * 31) ^ ((long)((char)var52)));
+    var54 = ((((char)var5) < ((char)-5)) ? ((unsigned char)var5) : ((unsigned char)-5));
+    var55 = ((((unsigned long)((((unsigned long)var53) * 31) ^ ((unsigned long)var54))) * 31) ^ ((long)((char)var54)));
+    var56 = ((((char)var4) > ((char)var5)) ? ((unsigned char)var4) : ((unsigned char)var5));
+    var57 = ((((unsigned long)((((unsigned long)var55) * 31) ^ ((unsigned long)var56))) * 31) ^ ((long)((char)var56)));
+    var58 = ((((char)var5) > ((char)-5)) ? ((unsigned char)var5) : ((unsigned char)-5));
+    var59 = ((((unsigned long)((((unsigned long)var57) * 31) ^ ((unsigned long)var58))) * 31) ^ ((long)((char)var58)));
+    var60 = ((((unsigned char)var4) < ((unsigned char)var5)) ? ((unsigned char)var4) : ((unsigned char)var5));
+    var61 = ((((unsigned long)((((unsigned long)var59) * 31) ^ ((unsigned long)var60))) * 31) ^ ((long)((char)var60)));
+    var62 = ((((unsigned char)var5) < ((unsigned char)-5)) ? ((unsigned char)var5) : ((unsigned char)-5));
+    var63 = ((((unsigned long)((((unsigned long)var61) * 31) ^ ((unsigned long)var62))) * 31) ^ ((long)((char)var62)));
+    var64 = ((((unsigned char)var4) > ((unsigned char)var5)) ? ((unsigned char)var4) : ((unsigned char)var5));
+    var65 = ((((unsigned long)((((unsigned long)var63) * 31) ^ ((unsigned long)var64))) * 31) ^ ((long)((char)var64)));
+    var66 = ((((unsigned char)var5) > ((unsigned char)-5)) ? ((unsigned char)var5) : ((unsigned char)-5));
+    var67 = ((((unsigned long)((((unsigned long)var65) * 31) ^ ((unsigned long)var66))) * 31) ^ ((long)((char)var66)));
+    var68 = ((unsigned short)var2);
+    var69 = (var68 * -99);
+    var70 = (var68 + 3);
+    var71 = (var70 | 1);
+    var72 = __builtin_popcount((unsigned short)var68);
+    var73 = ((((unsigned long)((((unsigned long)var67) * 31) ^ ((unsigned long)var72))) * 31) ^ ((long)((short)var72)));
+    var74 = (((unsigned short)var68) ? (__builtin_clz((unsigned short)var68) - 16) : 16);
+    var75 = ((((unsigned long)((((unsigned long)var73) * 31) ^ ((unsigned long)var74))) * 31) ^ ((long)((short)var74)));
+    var76 = (((unsigned short)var68) ? __builtin_ctz((unsigned short)var68) : 16);
+    var77 = ((((unsigned long)((((unsigned long)var75) * 31) ^ ((unsigned long)var76))) * 31) ^ ((long)((short)var76)));
+    var78 = __builtin_bswap16((unsigned short)var68);
+    var79 = ((((unsigned long)((((unsigned long)var77) * 31) ^ ((unsigned long)var78))) * 31) ^ ((long)((short)var78)));
+    var80 = __builtin_abs((short)var68);
+    var81 = ((((unsigned long)((((unsigned long)var79) * 31) ^ ((unsigned long)var80))) * 31) ^ ((long)((short)var80)));
+    var82 = __builtin_popcount((unsigned short)var69);
+    var83 = ((((unsigned long)((((unsigned long)var81) * 31) ^ ((unsigned long)var82))) * 31) ^ ((long)((short)var82)));
+    var84 = (((unsigned short)var69) ? (__builtin_clz((unsigned short)var69) - 16) : 16);
+    var85 = ((((unsigned long)((((unsigned long)var83) * 31) ^ ((unsigned long)var84))) * 31) ^ ((long)((short)var84)));
+    var86 = (((unsigned short)var69) ? __builtin_ctz((unsigned short)var69) : 16);
+    var87 = ((((unsigned long)((((unsigned long)var85) * 31) ^ ((unsigned long)var86))) * 31) ^ ((long)((short)var86)));
+    var88 = __builtin_bswap16((unsigned short)var69);
+    var89 = ((((unsigned long)((((unsigned long)var87) * 31) ^ ((unsigned long)var88))) * 31) ^ ((long)((short)var88)));
+    var90 = __builtin_abs((short)var69);
+    var91 = ((((unsigned long)((((unsigned long)var89) * 31) ^ ((unsigned long)var90))) * 31) ^ ((long)((short)var90)));
+    var92 = __builtin_popcount((unsigned short)-127);
+    var93 = ((((unsigned long)((((unsigned long)var91) * 31) ^ ((unsigned long)var92))) * 31) ^ ((long)((short)var92)));
+    var94 = (((unsigned short)-127) ? (__builtin_clz((unsigned short)-127) - 16) : 16);
+    var95 = ((((unsigned long)((((unsigned long)var93) * 31) ^ ((unsigned long)var94))) * 31) ^ ((long)((short)var94)));
+    var96 = (((unsigned short)-127) ? __builtin_ctz((unsigned short)-127) : 16);
+    var97 = ((((unsigned long)((((unsigned long)var95) * 31) ^ ((unsigned long)var96))) * 31) ^ ((long)((short)var96)));
+    var98 = __builtin_bswap16((unsigned short)-127);
+    var99 = ((((unsigned long)((((unsigned long)var97) * 31) ^ ((unsigned long)var98))) * 31) ^ ((long)((short)var98)));
+    var100 = __builtin_abs((short)-127);
+    var101 = ((((unsigned long)((((unsigned long)var99) * 31) ^ ((unsigned long)var100))) * 31) ^ ((long)((short)var100)));
+    var102 = (__builtin_clz((unsigned short)var71) - 16);
+    var103 = ((((unsigned long)((((unsigned long)var101) * 31) ^ ((unsigned long)var102))) * 31) ^ ((long)((short)var102)));
+    var104 = __builtin_abs((short)var69);
+    var105 = ((((unsigned long)((((unsigned long)var103) * 31) ^ ((unsigned long)var104))) * 31) ^ ((long)((short)var104)));
+    var106 = ((unsigned short)(((((unsigned short)var68) << 3) | (((unsigned short)var69) >> (13))) & 65535));
+    var107 = ((((unsigned long)((((unsigned long)var105) * 31) ^ ((unsigned long)var106))) * 31) ^ ((long)((short)var106)));
+    var108 = ((unsigned short)(((((unsigned short)var69) << (((unsigned short)var70) & 15)) | (((unsigned short)var69) >> ((-((unsigned short)var70)) & 15))) & 65535));
+    var109 = ((((unsigned long)((((unsigned long)var107) * 31) ^ ((unsigned long)var108))) * 31) ^ ((long)((short)var108)));
+    var110 = ((unsigned short)(((((unsigned short)-127) << 1) | (((unsigned short)-127) >> (15))) & 65535));
+    var111 = ((((unsigned long)((((unsigned long)var109) * 31) ^ ((unsigned long)var110))) * 31) ^ ((long)((short)var110)));
+    var112 = ((unsigned short)(((((unsigned short)var68) << (((unsigned short)var70) & 15)) | ((((unsigned short)-127) >> (1)) >> (15 - (((unsigned short)var70) & 15)))) & 65535));
+    var113 = ((((unsigned long)((((unsigned long)var111) * 31) ^ ((unsigned long)var112))) * 31) ^ ((long)((short)var112)));
+    var114 = ((unsigned short)(((((unsigned short)var68) << 13) | (((unsigned short)var69) >> (3))) & 65535));
+    var115 = ((((unsigned long)((((unsigned long)var113) * 31) ^ ((unsigned long)var114))) * 31) ^ ((long)((short)var114)));
+    var116 = ((unsigned short)(((((unsigned short)var69) << ((-((unsigned short)var70)) & 15)) | (((unsigned short)var69) >> (((unsigned short)var70) & 15))) & 65535));
+    var117 = ((((unsigned long)((((unsigned long)var115) * 31) ^ ((unsigned long)var116))) * 31) ^ ((long)((short)var116)));
+    var118 = ((unsigned short)(((((unsigned short)-127) << 15) | (((unsigned short)-127) >> (1))) & 65535));
+    var119 = ((((unsigned long)((((unsigned long)var117) * 31) ^ ((unsigned long)var118))) * 31) ^ ((long)((short)var118)));
+    var120 = ((unsigned short)((((((unsigned short)var68) << 1) << (15 - (((unsigned short)var70) & 15))) | (((unsigned short)-127) >> (((unsigned short)var70) & 15))) & 65535));
+    var121 = ((((unsigned long)((((unsigned long)var119) * 31) ^ ((unsigned long)var120))) * 31) ^ ((long)((short)var120)));
+    var122 = ((((short)var68) < ((short)var69)) ? ((unsigned short)var68) : ((unsigned short)var69));
+    var123 = ((((unsigned long)((((unsigned long)var121) * 31) ^ ((unsigned long)var122))) * 31) ^ ((long)((short)var122)));
+    var124 = ((((short)var69) < ((short)-5)) ? ((unsigned short)var69) : ((unsigned short)-5));
+    var125 = ((((unsigned long)((((unsigned long)var123) * 31) ^ ((unsigned long)var124))) * 31) ^ ((long)((short)var124)));
+    var126 = ((((short)var68) > ((short)var69)) ? ((unsigned short)var68) : ((unsigned short)var69));
+    var127 = ((((unsigned long)((((unsigned long)var125) * 31) ^ ((unsigned long)var126))) * 31) ^ ((long)((short)var126)));
+    var128 = ((((short)var69) > ((short)-5)) ? ((unsigned short)var69) : ((unsigned short)-5));
+    var129 = ((((unsigned long)((((unsigned long)var127) * 31) ^ ((unsigned long)var128))) * 31) ^ ((long)((short)var128)));
+    var130 = ((((unsigned short)var68) < ((unsigned short)var69)) ? ((unsigned short)var68) : ((unsigned short)var69));
+    var131 = ((((unsigned long)((((unsigned long)var129) * 31) ^ ((unsigned long)var130))) * 31) ^ ((long)((short)var130)));
+    var132 = ((((unsigned short)var69) < ((unsigned short)-5)) ? ((unsigned short)var69) : ((unsigned short)-5));
+    var133 = ((((unsigned long)((((unsigned long)var131) * 31) ^ ((unsigned long)var132))) * 31) ^ ((long)((short)var132)));
+    var134 = ((((unsigned short)var68) > ((unsigned short)var69)) ? ((unsigned short)var68) : ((unsigned short)var69));
+    var135 = ((((unsigned long)((((unsigned long)var133) * 31) ^ ((unsigned long)var134))) * 31) ^ ((long)((short)var134)));
+    var136 = ((((unsigned short)var69) > ((unsigned short)-5)) ? ((unsigned short)var69) : ((unsigned short)-5));
+    var137 = ((((unsigned long)((((unsigned long)var135) * 31) ^ ((unsigned long)var136))) * 31) ^ ((long)((short)var136)));
+    var138 = ((unsigned int)var2);
+    var139 = (var138 * -99);
+    var140 = (var138 + 3);
+    var141 = (var140 | 1);
+    var142 = __builtin_popcount((unsigned int)var138);
+    var143 = ((((unsigned long)((((unsigned long)var137) * 31) ^ ((unsigned long)var142))) * 31) ^ ((long)((int)var142)));
+    var144 = (((unsigned int)var138) ? __builtin_clz((unsigned int)var138) : 32);
+    var145 = ((((unsigned long)((((unsigned long)var143) * 31) ^ ((unsigned long)var144))) * 31) ^ ((long)((int)var144)));
+    var146 = (((unsigned int)var138) ? __builtin_ctz((unsigned int)var138) : 32);
+    var147 = ((((unsigned long)((((unsigned long)var145) * 31) ^ ((unsigned long)var146))) * 31) ^ ((long)((int)var146)));
+    var148 = __builtin_bswap32((unsigned int)var138);
+    var149 = ((((unsigned long)((((unsigned long)var147) * 31) ^ ((unsigned long)var148))) * 31) ^ ((long)((int)var148)));
+    var150 = ((((int)var138) < 0) ? (-((unsigned int)var138)) : ((unsigned int)var138));
+    var151 = ((((unsigned long)((((unsigned long)var149) * 31) ^ ((unsigned long)var150))) * 31) ^ ((long)((int)var150)));
+    var152 = __builtin_popcount((unsigned int)var139);
+    var153 = ((((unsigned long)((((unsigned long)var151) * 31) ^ ((unsigned long)var152))) * 31) ^ ((long)((int)var152)));
+    var154 = (((unsigned int)var139) ? __builtin_clz((unsigned int)var139) : 32);
+    var155 = ((((unsigned long)((((unsigned long)var153) * 31) ^ ((unsigned long)var154))) * 31) ^ ((long)((int)var154)));
+    var156 = (((unsigned int)var139) ? __builtin_ctz((unsigned int)var139) : 32);
+    var157 = ((((unsigned long)((((unsigned long)var155) * 31) ^ ((unsigned long)var156))) * 31) ^ ((long)((int)var156)));
+    var158 = __builtin_bswap32((unsigned int)var139);
+    var159 = ((((unsigned long)((((unsigned long)var157) * 31) ^ ((unsigned long)var158))) * 31) ^ ((long)((int)var158)));
+    var160 = ((((int)var139) < 0) ? (-((unsigned int)var139)) : ((unsigned int)var139));
+    var161 = ((((unsigned long)((((unsigned long)var159) * 31) ^ ((unsigned long)var160))) * 31) ^ ((long)((int)var160)));
+    var162 = __builtin_popcount((unsigned int)-127);
+    var163 = ((((unsigned long)((((unsigned long)var161) * 31) ^ ((unsigned long)var162))) * 31) ^ ((long)((int)var162)));
+    var164 = (((unsigned int)-127) ? __builtin_clz((unsigned int)-127) : 32);
+    var165 = ((((unsigned long)((((unsigned long)var163) * 31) ^ ((unsigned long)var164))) * 31) ^ ((long)((int)var164)));
+    var166 = (((unsigned int)-127) ? __builtin_ctz((unsigned int)-127) : 32);
+    var167 = ((((unsigned long)((((unsigned long)var165) * 31) ^ ((unsigned long)var166))) * 31) ^ ((long)((int)var166)));
+    var168 = __builtin_bswap32((unsigned int)-127);
+    var169 = ((((unsigned long)((((unsigned long)var167) * 31) ^ ((unsigned long)var168))) * 31) ^ ((long)((int)var168)));
+    var170 = ((((int)-127) < 0) ? (-((unsigned int)-127)) : ((unsigned int)-127));
+    var171 = ((((unsigned long)((((unsigned long)var169) * 31) ^ ((unsigned long)var170))) * 31) ^ ((long)((int)var170)));
+    var172 = __builtin_clz((unsigned int)var141);
+    var173 = ((((unsigned long)((((unsigned long)var171) * 31) ^ ((unsigned long)var172))) * 31) ^ ((long)((int)var172)));
+    var174 = __builtin_abs((int)var139);
+    var175 = ((((unsigned long)((((unsigned long)var173) * 31) ^ ((unsigned long)var174))) * 31) ^ ((long)((int)var174)));
+    var176 = ((((unsigned int)var138) << 3) | (((unsigned int)var139) >> (29)));
+    var177 = ((((unsigned long)((((unsigned long)var175) * 31) ^ ((unsigned long)var176))) * 31) ^ ((long)((int)var176)));
+    var178 = ((((unsigned int)var139) << (((unsigned int)var140) & 31)) | (((unsigned int)var139) >> ((-((unsigned int)var140)) & 31)));
+    var179 = ((((unsigned long)((((unsigned long)var177) * 31) ^ ((unsigned long)var178))) * 31) ^ ((long)((int)var178)));
+    var180 = ((((unsigned int)-127) << 1) | (((unsigned int)-127) >> (31)));
+    var181 = ((((unsigned long)((((unsigned long)var179) * 31) ^ ((unsigned long)var180))) * 31) ^ ((long)((int)var180)));
+    var182 = ((((unsigned int)var138) << (((unsigned int)var140) & 31)) | ((((unsigned int)-127) >> (1)) >> (31 - (((unsigned int)var140) & 31))));
+    var183 = ((((unsigned long)((((unsigned long)var181) * 31) ^ ((unsigned long)var182))) * 31) ^ ((long)((int)var182)));
+    var184 = ((((unsigned int)var138) << 29) | (((unsigned int)var139) >> (3)));
+    var185 = ((((unsigned long)((((unsigned long)var183) * 31) ^ ((unsigned long)var184))) * 31) ^ ((long)((int)var184)));
+    var186 = ((((unsigned int)var139) << ((-((unsigned int)var140)) & 31)) | (((unsigned int)var139) >> (((unsigned int)var140) & 31)));
+    var187 = ((((unsigned long)((((unsigned long)var185) * 31) ^ ((unsigned long)var186))) * 31) ^ ((long)((int)var186)));
+    var188 = ((((unsigned int)-127) << 31) | (((unsigned int)-127) >> (1)));
+    var189 = ((((unsigned long)((((unsigned long)var187) * 31) ^ ((unsigned long)var188))) * 31) ^ ((long)((int)var188)));
+    var190 = (((((unsigned int)var138) << 1) << (31 - (((unsigned int)var140) & 31))) | (((unsigned int)-127) >> (((unsigned int)var140) & 31)));
+    var191 = ((((unsigned long)((((unsigned long)var189) * 31) ^ ((unsigned long)var190))) * 31) ^ ((long)((int)var190)));
+    var192 = ((((int)var138) < ((int)var139)) ? ((unsigned int)var138) : ((unsigned int)var139));
+    var193 = ((((unsigned long)((((unsigned long)var191) * 31) ^ ((unsigned long)var192))) * 31) ^ ((long)((int)var192)));
+    var194 = ((((int)var139) < ((int)-5)) ? ((unsigned int)var139) : ((unsigned int)-5));
+    var195 = ((((unsigned long)((((unsigned long)var193) * 31) ^ ((unsigned long)var194))) * 31) ^ ((long)((int)var194)));
+    var196 = ((((int)var138) > ((int)var139)) ? ((unsigned int)var138) : ((unsigned int)var139));
+    var197 = ((((unsigned long)((((unsigned long)var195) * 31) ^ ((unsigned long)var196))) * 31) ^ ((long)((int)var196)));
+    var198 = ((((int)var139) > ((int)-5)) ? ((unsigned int)var139) : ((unsigned int)-5));
+    var199 = ((((unsigned long)((((unsigned long)var197) * 31) ^ ((unsigned long)var198))) * 31) ^ ((long)((int)var198)));
+    var200 = ((((unsigned int)var138) < ((unsigned int)var139)) ? ((unsigned int)var138) : ((unsigned int)var139));
+    var201 = ((((unsigned long)((((unsigned long)var199) * 31) ^ ((unsigned long)var200))) * 31) ^ ((long)((int)var200)));
+    var202 = ((((unsigned int)var139) < ((unsigned int)-5)) ? ((unsigned int)var139) : ((unsigned int)-5));
+    var203 = ((((unsigned long)((((unsigned long)var201) * 31) ^ ((unsigned long)var202))) * 31) ^ ((long)((int)var202)));
+    var204 = ((((unsigned int)var138) > ((unsigned int)var139)) ? ((unsigned int)var138) : ((unsigned int)var139));
+    var205 = ((((unsigned long)((((unsigned long)var203) * 31) ^ ((unsigned long)var204))) * 31) ^ ((long)((int)var204)));
+    var206 = ((((unsigned int)var139) > ((unsigned int)-5)) ? ((unsigned int)var139) : ((unsigned int)-5));
+    var207 = ((((unsigned long)((((unsigned long)var205) * 31) ^ ((unsigned long)var206))) * 31) ^ ((long)((int)var206)));
+    var208 = (((unsigned long)var2) + 0);
+    var209 = (((unsigned long)var208) * -99);
+    var210 = (((unsigned long)var208) + 3);
+    var211 = (var210 | 1);
+    var212 = ((((unsigned long)var207) * 31) ^ __builtin_popcountl((unsigned long)var208));
+    var213 = ((((unsigned long)var212) * 31) ^ (((unsigned long)var208) ? __builtin_clzl((unsigned long)var208) : 64));
+    var214 = ((((unsigned long)var213) * 31) ^ (((unsigned long)var208) ? __builtin_ctzl((unsigned long)var208) : 64));
+    var215 = ((((unsigned long)var214) * 31) ^ __builtin_bswap64((unsigned long)var208));
+    var216 = ((((unsigned long)var215) * 31) ^ ((((long)var208) < 0) ? (-((unsigned long)var208)) : ((unsigned long)var208)));
+    var217 = ((((unsigned long)var216) * 31) ^ __builtin_popcountl((unsigned long)var209));
+    var218 = ((((unsigned long)var217) * 31) ^ (((unsigned long)var209) ? __builtin_clzl((unsigned long)var209) : 64));
+    var219 = ((((unsigned long)var218) * 31) ^ (((unsigned long)var209) ? __builtin_ctzl((unsigned long)var209) : 64));
+    var220 = ((((unsigned long)var219) * 31) ^ __builtin_bswap64((unsigned long)var209));
+    var221 = ((((unsigned long)var220) * 31) ^ ((((long)var209) < 0) ? (-((unsigned long)var209)) : ((unsigned long)var209)));
+    var222 = ((((unsigned long)var221) * 31) ^ __builtin_popcountl((unsigned long)-127));
+    var223 = ((((unsigned long)var222) * 31) ^ (((unsigned long)-127) ? __builtin_clzl((unsigned long)-127) : 64));
+    var224 = ((((unsigned long)var223) * 31) ^ (((unsigned long)-127) ? __builtin_ctzl((unsigned long)-127) : 64));
+    var225 = ((((unsigned long)var224) * 31) ^ __builtin_bswap64((unsigned long)-127));
+    var226 = ((((unsigned long)var225) * 31) ^ ((((long)-127) < 0) ? (-((unsigned long)-127)) : ((unsigned long)-127)));
+    var227 = ((((unsigned long)var226) * 31) ^ __builtin_clzl((unsigned long)var211));
+    var228 = ((((unsigned long)var227) * 31) ^ __builtin_labs((long)var209));
+    var229 = ((((unsigned long)var228) * 31) ^ ((((unsigned long)var208) << 3) | (((unsigned long)var209) >> (61))));
+    var230 = ((((unsigned long)var229) * 31) ^ ((((unsigned long)var209) << (((unsigned long)var210) & 63)) | (((unsigned long)var209) >> ((-((unsigned long)var210)) & 63))));
+    var231 = ((((unsigned long)var230) * 31) ^ ((((unsigned long)-127) << 1) | (((unsigned long)-127) >> (63))));
+    var232 = ((((unsigned long)var231) * 31) ^ ((((unsigned long)var208) << (((unsigned long)var210) & 63)) | ((((unsigned long)-127) >> (1)) >> (63 - (((unsigned long)var210) & 63)))));
+    var233 = ((((unsigned long)var232) * 31) ^ ((((unsigned long)var208) << 61) | (((unsigned long)var209) >> (3))));
+    var234 = ((((unsigned long)var233) * 31) ^ ((((unsigned long)var209) << ((-((unsigned long)var210)) & 63)) | (((unsigned long)var209) >> (((unsigned long)var210) & 63))));
+    var235 = ((((unsigned long)var234) * 31) ^ ((((unsigned long)-127) << 63) | (((unsigned long)-127) >> (1))));
+    var236 = ((((unsigned long)var235) * 31) ^ (((((unsigned long)var208) << 1) << (63 - (((unsigned long)var210) & 63))) | (((unsigned long)-127) >> (((unsigned long)var210) & 63))));
+    var237 = ((((unsigned long)var236) * 31) ^ ((((long)var208) < ((long)var209)) ? ((unsigned long)var208) : ((unsigned long)var209)));
+    var238 = ((((unsigned long)var237) * 31) ^ ((((long)var209) < ((long)-5)) ? ((unsigned long)var209) : ((unsigned long)-5)));
+    var239 = ((((unsigned long)var238) * 31) ^ ((((long)var208) > ((long)var209)) ? ((unsigned long)var208) : ((unsigned long)var209)));
+    var240 = ((((unsigned long)var239) * 31) ^ ((((long)var209) > ((long)-5)) ? ((unsigned long)var209) : ((unsigned long)-5)));
+    var241 = ((((unsigned long)var240) * 31) ^ ((((unsigned long)var208) < ((unsigned long)var209)) ? ((unsigned long)var208) : ((unsigned long)var209)));
+    var242 = ((((unsigned long)var241) * 31) ^ ((((unsigned long)var209) < ((unsigned long)-5)) ? ((unsigned long)var209) : ((unsigned long)-5)));
+    var243 = ((((unsigned long)var242) * 31) ^ ((((unsigned long)var208) > ((unsigned long)var209)) ? ((unsigned long)var208) : ((unsigned long)var209)));
+    var244 = ((((unsigned long)var243) * 31) ^ ((((unsigned long)var209) > ((unsigned long)-5)) ? ((unsigned long)var209) : ((unsigned long)-5)));
+    return ((unsigned int)(var244 ^ ((unsigned long)(var244) >> (32)))) & 255;
+}
+
@@ -17,8 +17,8 @@ unsigned int isPrime(unsigned long var0){
         goto block3;
     }
     block3:
-    if (((long)i) < ((long)(num / 2))) {
-        if ((num % ((long)i)) == 0) {
+    if (((long)((int)i)) < ((long)(((long)num) / ((long)2)))) {
+        if ((((long)num) % ((long)((int)i))) == 0) {
             var1 = 0;
             return var1;
         } else {
@@ -46,7 +46,7 @@ int main(int var0, char** var1){
         return var2;
     } else {
         num = strtol(*(((unsigned char**)(argv)) + 1), &p, 10);
-        if (((int)(*p)) != 0) {
+        if (((int)((char)(*p))) != 0) {
             var2 = -1;
             return var2;
         } else {
@@ -18,16 +18,16 @@ int main(int var0, char** var1){
         return var2;
     } else {
         l = strtol(*(((unsigned char**)(argv)) + 1), &p, 10);
-        if (((int)(*p)) != 0) {
+        if (((int)((char)(*p))) != 0) {
             var2 = -1;
             return var2;
         } else {
             r = strtol(*(((unsigned char**)(argv)) + 2), &p, 10);
-            if (((int)(*p)) != 0) {
+            if (((int)((char)(*p))) != 0) {
                 var2 = -1;
                 return var2;
             } else {
-                if (((long)(l * l)) > ((long)(r * r))) {
+                if (((long)(((long)l) * ((long)l))) > ((long)(((long)r) * ((long)r)))) {
                     var2 = ((unsigned int)l);
                     return var2;
                 } else {
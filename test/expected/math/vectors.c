@@ -0,0 +1,59 @@
+// type definitions
+typedef unsigned int typeDef_0 __attribute__((vector_size(16), aligned(4)));
+typedef float typeDef_1 __attribute__((vector_size(16), aligned(4)));
+typedef unsigned long typeDef_2 __attribute__((vector_size(16), aligned(8)));
+typedef int typeDef_3 __attribute__((vector_size(16), aligned(4)));
+typedef unsigned int typeDef_4 __attribute__((vector_size(8), aligned(4)));
+typedef int typeDef_5 __attribute__((vector_size(8), aligned(4)));
+
+// function declarations
+extern unsigned int atoi(unsigned char* var0);
+int main(int var0, char** var1);
+
+int main(int var0, char** var1){
+    unsigned int var2;
+    unsigned int argc;
+    unsigned char** argv;
+    unsigned int n;
+    typeDef_0 a __attribute__((aligned(16)));
+    typeDef_0 b __attribute__((aligned(16)));
+    typeDef_0 sum __attribute__((aligned(16)));
+    typeDef_0 quot __attribute__((aligned(16)));
+    typeDef_0 shifted __attribute__((aligned(16)));
+    typeDef_0 logical __attribute__((aligned(16)));
+    typeDef_0 less __attribute__((aligned(16)));
+    typeDef_0 blend __attribute__((aligned(16)));
+    typeDef_1 f __attribute__((aligned(16)));
+    typeDef_0 back __attribute__((aligned(16)));
+    typeDef_0 reversed __attribute__((aligned(16)));
+    typeDef_2 wide __attribute__((aligned(16)));
+    unsigned int result;
+    block0:
+    var2 = 0;
+    argc = var0;
+    argv = var1;
+    if (argc != 2) {
+        var2 = -1;
+        return var2;
+    } else {
+        n = atoi(*(((unsigned char**)(argv)) + 1));
+        a = __builtin_shufflevector(__builtin_shufflevector(__builtin_shufflevector((typeDef_0){n,}, (typeDef_0){(*(&n)) * 2,}, 0, 4, 2, 3), (typeDef_0){0 - (*(&n)),}, 0, 1, 4, 3), (typeDef_0){7,}, 0, 1, 2, 4);
+        b = __builtin_shufflevector(__builtin_shufflevector((typeDef_0){3,-3,0,0,}, (typeDef_0){(*(&n)) | 1,}, 0, 1, 4, 3), (typeDef_0){((*(&n)) * (*(&n))) + 1,}, 0, 1, 2, 4);
+        a = __builtin_shufflevector(a, (typeDef_0){(*(&n)) + 5,}, 0, 1, 2, 4);
+        sum = (a + b);
+        quot = ((typeDef_0)(((typeDef_3)a) / ((typeDef_3)b)));
+        shifted = ((typeDef_0)(((typeDef_3)a) >> ((typeDef_0){1,1,1,1,})));
+        logical = ((a) >> ((typeDef_0){1,1,1,1,}));
+        less = ((typeDef_0)(-((typeDef_3)(-(((typeDef_3)a) < ((typeDef_3)b))))));
+        blend = ((a & less) | (b & (less ^ ((typeDef_0){-1,-1,-1,-1,}))));
+        f = (__builtin_convertvector((typeDef_3)sum, typeDef_1) * ((typeDef_1){0.5,0.5,0.5,0.5,}));
+        back = ((typeDef_0)__builtin_convertvector(f, typeDef_3));
+        reversed = __builtin_shufflevector(back, blend, 3, 2, 5, 4);
+        wide = __builtin_convertvector((typeDef_5)__builtin_shufflevector(quot, quot, 0, 1), typeDef_2);
+        result = (((int)(((int)(((int)(reversed[0])) + ((int)(reversed[1])))) + ((int)(reversed[2])))) + ((int)(reversed[3])));
+        result = (((int)result) + ((int)(((int)(((int)(((long)(wide[0])) - ((long)(wide[1])))) + ((int)(shifted[2])))) + ((int)((logical[2]) & 255)))));
+        var2 = (result & 127);
+        return var2;
+    }
+}
+
@@ -0,0 +1,70 @@
+// function declarations
+void add(unsigned long* restrict var0, unsigned long* restrict var1, unsigned int var2);
+int main(int var0, char** var1);
+extern unsigned long strtol(unsigned char* var0, unsigned char** var1, unsigned int var2);
+
+void add(unsigned long* restrict var0, unsigned long* restrict var1, unsigned int var2){
+    unsigned long* dst;
+    unsigned long* src;
+    unsigned int n;
+    unsigned int i;
+    unsigned long* var7;
+    block0:
+    dst = var0;
+    src = var1;
+    n = var2;
+    i = 0;
+    goto block1;
+    block1:
+    if (((int)i) < ((int)n)) {
+        var7 = (&(*(((unsigned long*)(dst)) + ((long)((int)i)))));
+        (*var7) = (((long)(*var7)) + ((long)(*(((unsigned long*)(src)) + ((long)((int)i))))));
+        i = (((int)i) + ((int)1));
+        goto block1;
+    } else {
+        return;
+    }
+}
+
+int main(int var0, char** var1){
+    unsigned int var2;
+    unsigned int argc;
+    unsigned char** argv;
+    unsigned char* p;
+    unsigned long num;
+    unsigned long a[3];
+    unsigned long b[3];
+    unsigned long* var9;
+    unsigned long* var10;
+    unsigned long* var11;
+    unsigned long* var12;
+    block0:
+    var2 = 0;
+    argc = var0;
+    argv = var1;
+    if (argc != 2) {
+        var2 = -1;
+        return var2;
+    } else {
+        num = strtol(*(((unsigned char**)(argv)) + 1), &p, 10);
+        if (((int)((char)(*p))) != 0) {
+            var2 = -1;
+            return var2;
+        } else {
+            var9 = (&(a[0]));
+            (*var9) = num;
+            var10 = (&(*(((unsigned long*)(var9)) + 1)));
+            (*var10) = 1;
+            (*(((unsigned long*)(var10)) + 1)) = 2;
+            var11 = (&(b[0]));
+            (*var11) = 3;
+            var12 = (&(*(((unsigned long*)(var11)) + 1)));
+            (*var12) = num;
+            (*(((unsigned long*)(var12)) + 1)) = 4;
+            add(&(a[0]), &(b[0]), 3);
+            var2 = ((unsigned int)(((long)(((long)(a[0])) + ((long)(a[1])))) - ((long)(a[2]))));
+            return var2;
+        }
+    }
+}
+
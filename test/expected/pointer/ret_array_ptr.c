@@ -3,8 +3,8 @@ union u1;
 
 // union definitions
 union u1 {
-    unsigned char* ty0;
-    unsigned char (*ty1)[5];
+    unsigned char (*ty0)[5];
+    unsigned char* ty1;
 };
 
 // function declarations
@@ -17,8 +17,8 @@ unsigned char (*get_me(void))[5]{
     union u1 var1;
     block0:
     me = malloc(5);
-    (var1.ty0) = me;
-    return var1.ty1;
+    (var1.ty1) = me;
+    return var1.ty0;
 }
 
 int main(int var0, char** var1){
@@ -31,8 +31,8 @@ int main(int var0, char** var1){
     var2 = 0;
     argc = var0;
     argv = var1;
-    (var6.ty1) = get_me();
-    s = (var6.ty0);
+    (var6.ty0) = get_me();
+    s = (var6.ty1);
     return (unsigned int)s;
 }
 
@@ -3,7 +3,7 @@ int main(void);
 extern unsigned int printf(unsigned char* var0, ...);
 
 // global variable definitions
-unsigned char _str[7] = {37,46,49,108,102,10,0,};
+unsigned char _str[7] = "%.1lf\n";
 
 int main(void){
     unsigned int var0;
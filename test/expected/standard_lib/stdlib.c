@@ -8,10 +8,10 @@ extern unsigned char* strcat(unsigned char* var0, unsigned char* var1);
 extern unsigned char* strcpy(unsigned char* var0, unsigned char* var1);
 
 // global variable definitions
-unsigned char _str[11] = {109,97,108,108,111,99,116,101,115,116,0,};
-unsigned char _str_1[4] = {37,115,10,0,};
-unsigned char _str_2[13] = {32,114,101,97,108,108,111,99,116,101,115,116,0,};
-unsigned char _str_3[3] = {37,115,0,};
+unsigned char _str[11] = "malloctest";
+unsigned char _str_1[4] = "%s\n";
+unsigned char _str_2[13] = " realloctest";
+unsigned char _str_3[3] = "%s";
 
 int main(void){
     unsigned int var0;
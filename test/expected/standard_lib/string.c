@@ -13,8 +13,8 @@ extern unsigned int printf(unsigned char* var0, ...);
 extern unsigned long strlen(unsigned char* var0);
 
 // global variable definitions
-unsigned char __const_main_test1[20] = {109,101,109,99,112,121,116,101,115,116,0,0,0,0,0,0,0,0,0,0,};
-unsigned char _str[4] = {37,115,10,0,};
+unsigned char __const_main_test1[20] = "memcpytest";
+unsigned char _str[4] = "%s\n";
 
 int main(void){
     unsigned int var0;
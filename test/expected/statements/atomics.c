@@ -0,0 +1,181 @@
+// struct declarations
+union u1;
+
+// anonymous struct declarations
+struct anonymous_struct0;
+struct anonymous_struct1;
+
+// struct definitions
+struct anonymous_struct0 {
+    unsigned int structVar0;
+    unsigned int structVar1;
+};
+struct anonymous_struct1 {
+    unsigned long structVar2;
+    unsigned int structVar3;
+};
+
+// union definitions
+union u1 {
+    unsigned int** ty0;
+    unsigned long* ty1;
+};
+
+// function declarations
+extern unsigned int atoi(unsigned char* var0);
+int main(int var0, char** var1);
+
+// global variable definitions
+unsigned char flags = -1;
+unsigned int counter = 0;
+unsigned int* owner = 0;
+
+int main(int var0, char** var1){
+    unsigned int var2;
+    unsigned int argc;
+    unsigned char** argv;
+    unsigned int n;
+    unsigned int var6;
+    unsigned int result;
+    unsigned int var8;
+    unsigned int var9;
+    unsigned int var10;
+    unsigned int var11;
+    unsigned int var12;
+    unsigned int var13;
+    unsigned char var14;
+    unsigned char var15;
+    unsigned int var16;
+    unsigned int var17;
+    unsigned int var18;
+    unsigned int var19;
+    unsigned int expected;
+    unsigned int var21;
+    unsigned char var22;
+    unsigned int* none;
+    unsigned int* var24;
+    unsigned char var25;
+    unsigned int var26;
+    unsigned char var27;
+    unsigned int var28;
+    unsigned int var29;
+    unsigned int var30;
+    unsigned int var31;
+    unsigned char var32;
+    unsigned int var33;
+    unsigned int var34;
+    unsigned int var35;
+    unsigned int var36;
+    unsigned int var37;
+    unsigned int var38;
+    struct anonymous_struct0 var39;
+    unsigned int var40;
+    unsigned int var41;
+    union u1 var42;
+    union u1 var43;
+    struct anonymous_struct1 var44;
+    unsigned long var45;
+    unsigned int var46;
+    unsigned int var47;
+    unsigned int var48;
+    unsigned char var49;
+    block0:
+    var2 = 0;
+    argc = var0;
+    argv = var1;
+    if (argc != 2) {
+        var2 = -1;
+        return var2;
+    } else {
+        n = atoi(*(((unsigned char**)(argv)) + 1));
+        var6 = n;
+        __atomic_store_n(&counter, var6, __ATOMIC_RELEASE);
+        var8 = 3;
+        var28 = __atomic_fetch_add(&counter, var8, __ATOMIC_ACQ_REL);
+        var9 = var28;
+        result = var9;
+        var10 = (((int)n) * ((int)2));
+        var29 = __atomic_exchange_n(&counter, var10, __ATOMIC_RELAXED);
+        var11 = var29;
+        result = (((int)result) + ((int)var11));
+        var12 = 1;
+        var30 = __atomic_fetch_sub(&counter, var12, __ATOMIC_SEQ_CST);
+        var13 = var30;
+        var31 = var13;
+        var14 = ((unsigned char)n);
+        var32 = __atomic_fetch_nand(&flags, var14, __ATOMIC_ACQUIRE);
+        var15 = var32;
+        result = (((int)result) + ((int)var15));
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        var16 = (((int)0) - ((int)n));
+        var33 = var16;
+        __atomic_load(&counter, &var34, __ATOMIC_RELAXED);
+        do {
+            var35 = ((((int)var34) > ((int)var33)) ? var34 : var33);
+        } while (!__atomic_compare_exchange(&counter, &var34, &var35, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+        var17 = var34;
+        result = (((int)result) + ((int)var17));
+        var18 = n;
+        var36 = var18;
+        __atomic_load(&counter, &var37, __ATOMIC_RELAXED);
+        do {
+            var38 = ((((unsigned int)var37) < ((unsigned int)var36)) ? var37 : var36);
+        } while (!__atomic_compare_exchange(&counter, &var37, &var38, 0, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE));
+        var19 = var37;
+        result = (result + var19);
+        expected = n;
+        var21 = 7;
+        (var39.structVar0) = expected;
+        (var39.structVar1) = __atomic_compare_exchange_n(&counter, &(var39.structVar0), var21, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+        var40 = (var39.structVar0);
+        var41 = (var39.structVar1);
+        if (var41) {
+            goto block4;
+        } else {
+            expected = var40;
+            goto block4;
+        }
+    }
+    block4:
+    var22 = ((unsigned char)var41);
+    if ((unsigned int)var22) {
+        result = (((int)result) + ((int)1));
+        goto block6;
+    } else {
+        goto block6;
+    }
+    block6:
+    result = (((int)result) + ((int)expected));
+    none = 0;
+    var24 = (&counter);
+    (var42.ty0) = (&none);
+    (var43.ty0) = (&var24);
+    (var44.structVar2) = (*(var42.ty1));
+    (var44.structVar3) = __atomic_compare_exchange_n(&owner, &(var44.structVar2), *(var43.ty1), 1, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    var45 = (var44.structVar2);
+    var46 = (var44.structVar3);
+    if (var46) {
+        goto block8;
+    } else {
+        (*(var42.ty1)) = var45;
+        goto block8;
+    }
+    block8:
+    var25 = ((unsigned char)var46);
+    if ((unsigned int)var25) {
+        result = (((int)result) + ((int)(*owner)));
+        goto block10;
+    } else {
+        goto block10;
+    }
+    block10:
+    var47 = __atomic_load_n(&counter, __ATOMIC_ACQUIRE);
+    var26 = var47;
+    var48 = var26;
+    var49 = __atomic_load_n(&flags, __ATOMIC_SEQ_CST);
+    var27 = var49;
+    result = (((int)result) + ((int)(((int)var48) + ((int)var27))));
+    var2 = (result & 127);
+    return var2;
+}
+
@@ -13,7 +13,7 @@ struct s_mystruct* get_mystruct(void);
 int main(int var0, char** var1);
 
 // global variable definitions
-struct s_mystruct i = {0,0,0,};
+struct s_mystruct i = {0};
 
 struct s_mystruct* get_mystruct(void){
     block0:
@@ -13,9 +13,9 @@ struct s_arrptr {
 
 // union definitions
 union u1 {
-    unsigned char* ty0;
+    struct s_test (*ty0)[1];
     struct s_test* ty1;
-    struct s_test (*ty2)[1];
+    unsigned char* ty2;
 };
 
 // function declarations
@@ -43,7 +43,7 @@ int main(int var0, char** var1){
         return var2;
     } else {
         num = strtol(*(((unsigned char**)(argv)) + 1), &p, 10);
-        if (((int)(*p)) != 0) {
+        if (((int)((char)(*p))) != 0) {
             var2 = -1;
             return var2;
         } else {
@@ -52,7 +52,7 @@ int main(int var0, char** var1){
             (var11.ty1) = (&t);
             (arr[0]) = t;
             (var12.ty1) = (&(arr[0]));
-            (aptr.structVar1) = (var12.ty2);
+            (aptr.structVar1) = (var12.ty0);
             var2 = (((*(aptr.structVar1))[0]).structVar0);
             return var2;
         }
@@ -19,7 +19,7 @@ int main(int var0, char** var1);
 extern unsigned int printf(unsigned char* var0, ...);
 
 // global variable definitions
-unsigned char _str[4] = {37,117,10,0,};
+unsigned char _str[4] = "%u\n";
 
 int main(int var0, char** var1){
     unsigned int var2;
@@ -0,0 +1,52 @@
+; Branch weights of optimized or profiled code, conditions and switches taken with high probability use __builtin_expect.
+
+define i32 @main(i32 %argc, i8** %argv) {
+entry:
+  %arg = getelementptr inbounds i8*, i8** %argv, i64 1
+  %str = load i8*, i8** %arg
+  %n = call i32 @atoi(i8* %str)
+  %positive = icmp sgt i32 %n, 0
+  br i1 %positive, label %likely, label %unlikely, !prof !0
+
+likely:
+  %double = shl i32 %n, 1
+  ret i32 %double
+
+unlikely:
+  %wide = sext i32 %n to i64
+  %expected = call i64 @llvm.expect.i64(i64 %wide, i64 -3)
+  %small = trunc i64 %expected to i32
+  switch i32 %small, label %default [
+    i32 -1, label %one
+    i32 -3, label %three
+    i32 -7, label %seven
+  ], !prof !1
+
+one:
+  ret i32 11
+
+three:
+  ret i32 13
+
+seven:
+  ret i32 17
+
+default:
+  %cold = icmp eq i32 %n, 0
+  br i1 %cold, label %zero, label %other, !prof !2
+
+zero:
+  ret i32 19
+
+other:
+  %neg = sub i32 0, %n
+  ret i32 %neg
+}
+
+declare i32 @atoi(i8*)
+
+declare i64 @llvm.expect.i64(i64, i64)
+
+!0 = !{!"branch_weights", i32 2000, i32 1}
+!1 = !{!"branch_weights", i32 10, i32 5, i32 2000, i32 20}
+!2 = !{!"branch_weights", i32 1, i32 2000}
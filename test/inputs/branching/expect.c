@@ -0,0 +1,27 @@
+#include <stdlib.h>
+
+int main(int argc, char** argv) {
+	if (argc != 2) {
+		return -1;
+	}
+
+	char *p;
+	long num = strtol(argv[1], &p, 10);
+
+	if (__builtin_expect(*p != '\0', 0)) {
+		return -1;
+	}
+
+	if (__builtin_expect(num > 0, 1)) {
+		return num * 2;
+	}
+
+	switch (__builtin_expect(num, -1)) {
+	case -1:
+		return 7;
+	case -2:
+		return 9;
+	default:
+		return 1;
+	}
+}
@@ -0,0 +1,34 @@
+; Loop with two entries (head and body are both reachable from entry), which has no structured form in C.
+
+define i32 @main(i32 %argc, i8** %argv) {
+entry:
+  %arg = getelementptr inbounds i8*, i8** %argv, i64 1
+  %str = load i8*, i8** %arg
+  %n = call i32 @atoi(i8* %str)
+  %odd = and i32 %n, 1
+  %start = icmp eq i32 %odd, 0
+  br i1 %start, label %head, label %body
+
+head:
+  %i = phi i32 [ %n, %entry ], [ %k, %body ]
+  %sum = phi i32 [ 0, %entry ], [ %t, %body ]
+  %j = add i32 %i, 3
+  %s = add i32 %sum, %j
+  %more = icmp slt i32 %j, 40
+  br i1 %more, label %body, label %exit
+
+body:
+  %x = phi i32 [ %n, %entry ], [ %j, %head ]
+  %acc = phi i32 [ 1, %entry ], [ %s, %head ]
+  %t = mul i32 %acc, 3
+  %k = add i32 %x, 5
+  %again = icmp slt i32 %k, 30
+  br i1 %again, label %head, label %exit
+
+exit:
+  %r = phi i32 [ %s, %head ], [ %t, %body ]
+  %m = and i32 %r, 127
+  ret i32 %m
+}
+
+declare i32 @atoi(i8*)
@@ -0,0 +1,31 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+float table[8] __attribute__((aligned(32))) = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+typedef struct {
+    int values[4];
+} __attribute__((aligned(16))) Block;
+
+int sum(Block* block) {
+    return block->values[0] + block->values[1] + block->values[2] + block->values[3];
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        return -1;
+    }
+
+    int n = atoi(argv[1]);
+    Block block __attribute__((aligned(64)));
+    for (int i = 0; i < 4; i++) {
+        block.values[i] = n + i;
+    }
+
+    int result = sum(&block) + (int)table[n & 7];
+    if ((uintptr_t)&block % 64 != 0 || (uintptr_t)table % 32 != 0) {
+        result = 0;
+    }
+
+    return result & 0x7f;
+}
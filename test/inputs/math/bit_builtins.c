@@ -0,0 +1,28 @@
+#include <stdlib.h>
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        return -1;
+    }
+
+    int n = atoi(argv[1]);
+    unsigned x = (unsigned)n * 2654435761u;
+    unsigned long y = (unsigned long)x << 20 | 1;
+
+    int result = __builtin_popcount(x) + __builtin_popcountl(y);
+    result += __builtin_clz(x | 1) + __builtin_ctz(x | 0x80000000u) + __builtin_ctzl(y);
+    result += __builtin_bswap32(x) >> 28;
+    result += abs(n) + labs((long)n * 3);
+
+    int sum;
+    if (__builtin_add_overflow(n, 2147483640, &sum)) {
+        result += 1;
+    }
+
+    unsigned product;
+    if (__builtin_mul_overflow(x, 3u, &product)) {
+        result += 2;
+    }
+
+    return result & 0x7f;
+}
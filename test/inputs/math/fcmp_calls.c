@@ -0,0 +1,29 @@
+#include <stdlib.h>
+
+int calls;
+
+double next(double x) {
+    calls++;
+    return x / 2;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        return -1;
+    }
+
+    double n = atoi(argv[1]);
+    int result = 0;
+
+    if (__builtin_isunordered(next(n), 0.0)) {
+        result += 1;
+    }
+    if (__builtin_islessgreater(next(n), 1.0)) {
+        result += 2;
+    }
+    if (!__builtin_islessgreater(next(n), 0.0)) {
+        result += 4;
+    }
+
+    return result + 8 * calls;
+}
@@ -0,0 +1,852 @@
+; Calls of the bit-manipulation, minimum/maximum and abs intrinsics on 8, 16, 32 and 64 bit integers,
+; including constant operands. Zero and sign extensions of every result are mixed into the exit code.
+
+define i32 @main(i32 %argc, i8** %argv) {
+entry:
+  %arg = getelementptr inbounds i8*, i8** %argv, i64 1
+  %str = load i8*, i8** %arg
+  %int = call i32 @atoi(i8* %str)
+  %n = sext i32 %int to i64
+  %h0 = add i64 %n, 0
+  ; i8
+  %t1 = trunc i64 %n to i8
+  %t2 = mul i8 %t1, -99
+  %t3 = add i8 %t1, 3
+  %t4 = or i8 %t3, 1
+  %t5 = call i8 @llvm.ctpop.i8(i8 %t1)
+  %t6 = zext i8 %t5 to i64
+  %t7 = mul i64 %h0, 31
+  %t8 = xor i64 %t7, %t6
+  %t9 = sext i8 %t5 to i64
+  %t10 = mul i64 %t8, 31
+  %t11 = xor i64 %t10, %t9
+  %t12 = call i8 @llvm.ctlz.i8(i8 %t1, i1 false)
+  %t13 = zext i8 %t12 to i64
+  %t14 = mul i64 %t11, 31
+  %t15 = xor i64 %t14, %t13
+  %t16 = sext i8 %t12 to i64
+  %t17 = mul i64 %t15, 31
+  %t18 = xor i64 %t17, %t16
+  %t19 = call i8 @llvm.cttz.i8(i8 %t1, i1 false)
+  %t20 = zext i8 %t19 to i64
+  %t21 = mul i64 %t18, 31
+  %t22 = xor i64 %t21, %t20
+  %t23 = sext i8 %t19 to i64
+  %t24 = mul i64 %t22, 31
+  %t25 = xor i64 %t24, %t23
+  %t26 = call i8 @llvm.abs.i8(i8 %t1, i1 false)
+  %t27 = zext i8 %t26 to i64
+  %t28 = mul i64 %t25, 31
+  %t29 = xor i64 %t28, %t27
+  %t30 = sext i8 %t26 to i64
+  %t31 = mul i64 %t29, 31
+  %t32 = xor i64 %t31, %t30
+  %t33 = call i8 @llvm.ctpop.i8(i8 %t2)
+  %t34 = zext i8 %t33 to i64
+  %t35 = mul i64 %t32, 31
+  %t36 = xor i64 %t35, %t34
+  %t37 = sext i8 %t33 to i64
+  %t38 = mul i64 %t36, 31
+  %t39 = xor i64 %t38, %t37
+  %t40 = call i8 @llvm.ctlz.i8(i8 %t2, i1 false)
+  %t41 = zext i8 %t40 to i64
+  %t42 = mul i64 %t39, 31
+  %t43 = xor i64 %t42, %t41
+  %t44 = sext i8 %t40 to i64
+  %t45 = mul i64 %t43, 31
+  %t46 = xor i64 %t45, %t44
+  %t47 = call i8 @llvm.cttz.i8(i8 %t2, i1 false)
+  %t48 = zext i8 %t47 to i64
+  %t49 = mul i64 %t46, 31
+  %t50 = xor i64 %t49, %t48
+  %t51 = sext i8 %t47 to i64
+  %t52 = mul i64 %t50, 31
+  %t53 = xor i64 %t52, %t51
+  %t54 = call i8 @llvm.abs.i8(i8 %t2, i1 false)
+  %t55 = zext i8 %t54 to i64
+  %t56 = mul i64 %t53, 31
+  %t57 = xor i64 %t56, %t55
+  %t58 = sext i8 %t54 to i64
+  %t59 = mul i64 %t57, 31
+  %t60 = xor i64 %t59, %t58
+  %t61 = call i8 @llvm.ctpop.i8(i8 -127)
+  %t62 = zext i8 %t61 to i64
+  %t63 = mul i64 %t60, 31
+  %t64 = xor i64 %t63, %t62
+  %t65 = sext i8 %t61 to i64
+  %t66 = mul i64 %t64, 31
+  %t67 = xor i64 %t66, %t65
+  %t68 = call i8 @llvm.ctlz.i8(i8 -127, i1 false)
+  %t69 = zext i8 %t68 to i64
+  %t70 = mul i64 %t67, 31
+  %t71 = xor i64 %t70, %t69
+  %t72 = sext i8 %t68 to i64
+  %t73 = mul i64 %t71, 31
+  %t74 = xor i64 %t73, %t72
+  %t75 = call i8 @llvm.cttz.i8(i8 -127, i1 false)
+  %t76 = zext i8 %t75 to i64
+  %t77 = mul i64 %t74, 31
+  %t78 = xor i64 %t77, %t76
+  %t79 = sext i8 %t75 to i64
+  %t80 = mul i64 %t78, 31
+  %t81 = xor i64 %t80, %t79
+  %t82 = call i8 @llvm.abs.i8(i8 -127, i1 false)
+  %t83 = zext i8 %t82 to i64
+  %t84 = mul i64 %t81, 31
+  %t85 = xor i64 %t84, %t83
+  %t86 = sext i8 %t82 to i64
+  %t87 = mul i64 %t85, 31
+  %t88 = xor i64 %t87, %t86
+  %t89 = call i8 @llvm.ctlz.i8(i8 %t4, i1 true)
+  %t90 = zext i8 %t89 to i64
+  %t91 = mul i64 %t88, 31
+  %t92 = xor i64 %t91, %t90
+  %t93 = sext i8 %t89 to i64
+  %t94 = mul i64 %t92, 31
+  %t95 = xor i64 %t94, %t93
+  %t96 = call i8 @llvm.abs.i8(i8 %t2, i1 true)
+  %t97 = zext i8 %t96 to i64
+  %t98 = mul i64 %t95, 31
+  %t99 = xor i64 %t98, %t97
+  %t100 = sext i8 %t96 to i64
+  %t101 = mul i64 %t99, 31
+  %t102 = xor i64 %t101, %t100
+  %t103 = call i8 @llvm.fshl.i8(i8 %t1, i8 %t2, i8 3)
+  %t104 = zext i8 %t103 to i64
+  %t105 = mul i64 %t102, 31
+  %t106 = xor i64 %t105, %t104
+  %t107 = sext i8 %t103 to i64
+  %t108 = mul i64 %t106, 31
+  %t109 = xor i64 %t108, %t107
+  %t110 = call i8 @llvm.fshl.i8(i8 %t2, i8 %t2, i8 %t3)
+  %t111 = zext i8 %t110 to i64
+  %t112 = mul i64 %t109, 31
+  %t113 = xor i64 %t112, %t111
+  %t114 = sext i8 %t110 to i64
+  %t115 = mul i64 %t113, 31
+  %t116 = xor i64 %t115, %t114
+  %t117 = call i8 @llvm.fshl.i8(i8 -127, i8 -127, i8 1)
+  %t118 = zext i8 %t117 to i64
+  %t119 = mul i64 %t116, 31
+  %t120 = xor i64 %t119, %t118
+  %t121 = sext i8 %t117 to i64
+  %t122 = mul i64 %t120, 31
+  %t123 = xor i64 %t122, %t121
+  %t124 = call i8 @llvm.fshl.i8(i8 %t1, i8 -127, i8 %t3)
+  %t125 = zext i8 %t124 to i64
+  %t126 = mul i64 %t123, 31
+  %t127 = xor i64 %t126, %t125
+  %t128 = sext i8 %t124 to i64
+  %t129 = mul i64 %t127, 31
+  %t130 = xor i64 %t129, %t128
+  %t131 = call i8 @llvm.fshr.i8(i8 %t1, i8 %t2, i8 3)
+  %t132 = zext i8 %t131 to i64
+  %t133 = mul i64 %t130, 31
+  %t134 = xor i64 %t133, %t132
+  %t135 = sext i8 %t131 to i64
+  %t136 = mul i64 %t134, 31
+  %t137 = xor i64 %t136, %t135
+  %t138 = call i8 @llvm.fshr.i8(i8 %t2, i8 %t2, i8 %t3)
+  %t139 = zext i8 %t138 to i64
+  %t140 = mul i64 %t137, 31
+  %t141 = xor i64 %t140, %t139
+  %t142 = sext i8 %t138 to i64
+  %t143 = mul i64 %t141, 31
+  %t144 = xor i64 %t143, %t142
+  %t145 = call i8 @llvm.fshr.i8(i8 -127, i8 -127, i8 1)
+  %t146 = zext i8 %t145 to i64
+  %t147 = mul i64 %t144, 31
+  %t148 = xor i64 %t147, %t146
+  %t149 = sext i8 %t145 to i64
+  %t150 = mul i64 %t148, 31
+  %t151 = xor i64 %t150, %t149
+  %t152 = call i8 @llvm.fshr.i8(i8 %t1, i8 -127, i8 %t3)
+  %t153 = zext i8 %t152 to i64
+  %t154 = mul i64 %t151, 31
+  %t155 = xor i64 %t154, %t153
+  %t156 = sext i8 %t152 to i64
+  %t157 = mul i64 %t155, 31
+  %t158 = xor i64 %t157, %t156
+  %t159 = call i8 @llvm.smin.i8(i8 %t1, i8 %t2)
+  %t160 = zext i8 %t159 to i64
+  %t161 = mul i64 %t158, 31
+  %t162 = xor i64 %t161, %t160
+  %t163 = sext i8 %t159 to i64
+  %t164 = mul i64 %t162, 31
+  %t165 = xor i64 %t164, %t163
+  %t166 = call i8 @llvm.smin.i8(i8 %t2, i8 -5)
+  %t167 = zext i8 %t166 to i64
+  %t168 = mul i64 %t165, 31
+  %t169 = xor i64 %t168, %t167
+  %t170 = sext i8 %t166 to i64
+  %t171 = mul i64 %t169, 31
+  %t172 = xor i64 %t171, %t170
+  %t173 = call i8 @llvm.smax.i8(i8 %t1, i8 %t2)
+  %t174 = zext i8 %t173 to i64
+  %t175 = mul i64 %t172, 31
+  %t176 = xor i64 %t175, %t174
+  %t177 = sext i8 %t173 to i64
+  %t178 = mul i64 %t176, 31
+  %t179 = xor i64 %t178, %t177
+  %t180 = call i8 @llvm.smax.i8(i8 %t2, i8 -5)
+  %t181 = zext i8 %t180 to i64
+  %t182 = mul i64 %t179, 31
+  %t183 = xor i64 %t182, %t181
+  %t184 = sext i8 %t180 to i64
+  %t185 = mul i64 %t183, 31
+  %t186 = xor i64 %t185, %t184
+  %t187 = call i8 @llvm.umin.i8(i8 %t1, i8 %t2)
+  %t188 = zext i8 %t187 to i64
+  %t189 = mul i64 %t186, 31
+  %t190 = xor i64 %t189, %t188
+  %t191 = sext i8 %t187 to i64
+  %t192 = mul i64 %t190, 31
+  %t193 = xor i64 %t192, %t191
+  %t194 = call i8 @llvm.umin.i8(i8 %t2, i8 -5)
+  %t195 = zext i8 %t194 to i64
+  %t196 = mul i64 %t193, 31
+  %t197 = xor i64 %t196, %t195
+  %t198 = sext i8 %t194 to i64
+  %t199 = mul i64 %t197, 31
+  %t200 = xor i64 %t199, %t198
+  %t201 = call i8 @llvm.umax.i8(i8 %t1, i8 %t2)
+  %t202 = zext i8 %t201 to i64
+  %t203 = mul i64 %t200, 31
+  %t204 = xor i64 %t203, %t202
+  %t205 = sext i8 %t201 to i64
+  %t206 = mul i64 %t204, 31
+  %t207 = xor i64 %t206, %t205
+  %t208 = call i8 @llvm.umax.i8(i8 %t2, i8 -5)
+  %t209 = zext i8 %t208 to i64
+  %t210 = mul i64 %t207, 31
+  %t211 = xor i64 %t210, %t209
+  %t212 = sext i8 %t208 to i64
+  %t213 = mul i64 %t211, 31
+  %t214 = xor i64 %t213, %t212
+  ; i16
+  %t215 = trunc i64 %n to i16
+  %t216 = mul i16 %t215, -99
+  %t217 = add i16 %t215, 3
+  %t218 = or i16 %t217, 1
+  %t219 = call i16 @llvm.ctpop.i16(i16 %t215)
+  %t220 = zext i16 %t219 to i64
+  %t221 = mul i64 %t214, 31
+  %t222 = xor i64 %t221, %t220
+  %t223 = sext i16 %t219 to i64
+  %t224 = mul i64 %t222, 31
+  %t225 = xor i64 %t224, %t223
+  %t226 = call i16 @llvm.ctlz.i16(i16 %t215, i1 false)
+  %t227 = zext i16 %t226 to i64
+  %t228 = mul i64 %t225, 31
+  %t229 = xor i64 %t228, %t227
+  %t230 = sext i16 %t226 to i64
+  %t231 = mul i64 %t229, 31
+  %t232 = xor i64 %t231, %t230
+  %t233 = call i16 @llvm.cttz.i16(i16 %t215, i1 false)
+  %t234 = zext i16 %t233 to i64
+  %t235 = mul i64 %t232, 31
+  %t236 = xor i64 %t235, %t234
+  %t237 = sext i16 %t233 to i64
+  %t238 = mul i64 %t236, 31
+  %t239 = xor i64 %t238, %t237
+  %t240 = call i16 @llvm.bswap.i16(i16 %t215)
+  %t241 = zext i16 %t240 to i64
+  %t242 = mul i64 %t239, 31
+  %t243 = xor i64 %t242, %t241
+  %t244 = sext i16 %t240 to i64
+  %t245 = mul i64 %t243, 31
+  %t246 = xor i64 %t245, %t244
+  %t247 = call i16 @llvm.abs.i16(i16 %t215, i1 false)
+  %t248 = zext i16 %t247 to i64
+  %t249 = mul i64 %t246, 31
+  %t250 = xor i64 %t249, %t248
+  %t251 = sext i16 %t247 to i64
+  %t252 = mul i64 %t250, 31
+  %t253 = xor i64 %t252, %t251
+  %t254 = call i16 @llvm.ctpop.i16(i16 %t216)
+  %t255 = zext i16 %t254 to i64
+  %t256 = mul i64 %t253, 31
+  %t257 = xor i64 %t256, %t255
+  %t258 = sext i16 %t254 to i64
+  %t259 = mul i64 %t257, 31
+  %t260 = xor i64 %t259, %t258
+  %t261 = call i16 @llvm.ctlz.i16(i16 %t216, i1 false)
+  %t262 = zext i16 %t261 to i64
+  %t263 = mul i64 %t260, 31
+  %t264 = xor i64 %t263, %t262
+  %t265 = sext i16 %t261 to i64
+  %t266 = mul i64 %t264, 31
+  %t267 = xor i64 %t266, %t265
+  %t268 = call i16 @llvm.cttz.i16(i16 %t216, i1 false)
+  %t269 = zext i16 %t268 to i64
+  %t270 = mul i64 %t267, 31
+  %t271 = xor i64 %t270, %t269
+  %t272 = sext i16 %t268 to i64
+  %t273 = mul i64 %t271, 31
+  %t274 = xor i64 %t273, %t272
+  %t275 = call i16 @llvm.bswap.i16(i16 %t216)
+  %t276 = zext i16 %t275 to i64
+  %t277 = mul i64 %t274, 31
+  %t278 = xor i64 %t277, %t276
+  %t279 = sext i16 %t275 to i64
+  %t280 = mul i64 %t278, 31
+  %t281 = xor i64 %t280, %t279
+  %t282 = call i16 @llvm.abs.i16(i16 %t216, i1 false)
+  %t283 = zext i16 %t282 to i64
+  %t284 = mul i64 %t281, 31
+  %t285 = xor i64 %t284, %t283
+  %t286 = sext i16 %t282 to i64
+  %t287 = mul i64 %t285, 31
+  %t288 = xor i64 %t287, %t286
+  %t289 = call i16 @llvm.ctpop.i16(i16 -127)
+  %t290 = zext i16 %t289 to i64
+  %t291 = mul i64 %t288, 31
+  %t292 = xor i64 %t291, %t290
+  %t293 = sext i16 %t289 to i64
+  %t294 = mul i64 %t292, 31
+  %t295 = xor i64 %t294, %t293
+  %t296 = call i16 @llvm.ctlz.i16(i16 -127, i1 false)
+  %t297 = zext i16 %t296 to i64
+  %t298 = mul i64 %t295, 31
+  %t299 = xor i64 %t298, %t297
+  %t300 = sext i16 %t296 to i64
+  %t301 = mul i64 %t299, 31
+  %t302 = xor i64 %t301, %t300
+  %t303 = call i16 @llvm.cttz.i16(i16 -127, i1 false)
+  %t304 = zext i16 %t303 to i64
+  %t305 = mul i64 %t302, 31
+  %t306 = xor i64 %t305, %t304
+  %t307 = sext i16 %t303 to i64
+  %t308 = mul i64 %t306, 31
+  %t309 = xor i64 %t308, %t307
+  %t310 = call i16 @llvm.bswap.i16(i16 -127)
+  %t311 = zext i16 %t310 to i64
+  %t312 = mul i64 %t309, 31
+  %t313 = xor i64 %t312, %t311
+  %t314 = sext i16 %t310 to i64
+  %t315 = mul i64 %t313, 31
+  %t316 = xor i64 %t315, %t314
+  %t317 = call i16 @llvm.abs.i16(i16 -127, i1 false)
+  %t318 = zext i16 %t317 to i64
+  %t319 = mul i64 %t316, 31
+  %t320 = xor i64 %t319, %t318
+  %t321 = sext i16 %t317 to i64
+  %t322 = mul i64 %t320, 31
+  %t323 = xor i64 %t322, %t321
+  %t324 = call i16 @llvm.ctlz.i16(i16 %t218, i1 true)
+  %t325 = zext i16 %t324 to i64
+  %t326 = mul i64 %t323, 31
+  %t327 = xor i64 %t326, %t325
+  %t328 = sext i16 %t324 to i64
+  %t329 = mul i64 %t327, 31
+  %t330 = xor i64 %t329, %t328
+  %t331 = call i16 @llvm.abs.i16(i16 %t216, i1 true)
+  %t332 = zext i16 %t331 to i64
+  %t333 = mul i64 %t330, 31
+  %t334 = xor i64 %t333, %t332
+  %t335 = sext i16 %t331 to i64
+  %t336 = mul i64 %t334, 31
+  %t337 = xor i64 %t336, %t335
+  %t338 = call i16 @llvm.fshl.i16(i16 %t215, i16 %t216, i16 3)
+  %t339 = zext i16 %t338 to i64
+  %t340 = mul i64 %t337, 31
+  %t341 = xor i64 %t340, %t339
+  %t342 = sext i16 %t338 to i64
+  %t343 = mul i64 %t341, 31
+  %t344 = xor i64 %t343, %t342
+  %t345 = call i16 @llvm.fshl.i16(i16 %t216, i16 %t216, i16 %t217)
+  %t346 = zext i16 %t345 to i64
+  %t347 = mul i64 %t344, 31
+  %t348 = xor i64 %t347, %t346
+  %t349 = sext i16 %t345 to i64
+  %t350 = mul i64 %t348, 31
+  %t351 = xor i64 %t350, %t349
+  %t352 = call i16 @llvm.fshl.i16(i16 -127, i16 -127, i16 1)
+  %t353 = zext i16 %t352 to i64
+  %t354 = mul i64 %t351, 31
+  %t355 = xor i64 %t354, %t353
+  %t356 = sext i16 %t352 to i64
+  %t357 = mul i64 %t355, 31
+  %t358 = xor i64 %t357, %t356
+  %t359 = call i16 @llvm.fshl.i16(i16 %t215, i16 -127, i16 %t217)
+  %t360 = zext i16 %t359 to i64
+  %t361 = mul i64 %t358, 31
+  %t362 = xor i64 %t361, %t360
+  %t363 = sext i16 %t359 to i64
+  %t364 = mul i64 %t362, 31
+  %t365 = xor i64 %t364, %t363
+  %t366 = call i16 @llvm.fshr.i16(i16 %t215, i16 %t216, i16 3)
+  %t367 = zext i16 %t366 to i64
+  %t368 = mul i64 %t365, 31
+  %t369 = xor i64 %t368, %t367
+  %t370 = sext i16 %t366 to i64
+  %t371 = mul i64 %t369, 31
+  %t372 = xor i64 %t371, %t370
+  %t373 = call i16 @llvm.fshr.i16(i16 %t216, i16 %t216, i16 %t217)
+  %t374 = zext i16 %t373 to i64
+  %t375 = mul i64 %t372, 31
+  %t376 = xor i64 %t375, %t374
+  %t377 = sext i16 %t373 to i64
+  %t378 = mul i64 %t376, 31
+  %t379 = xor i64 %t378, %t377
+  %t380 = call i16 @llvm.fshr.i16(i16 -127, i16 -127, i16 1)
+  %t381 = zext i16 %t380 to i64
+  %t382 = mul i64 %t379, 31
+  %t383 = xor i64 %t382, %t381
+  %t384 = sext i16 %t380 to i64
+  %t385 = mul i64 %t383, 31
+  %t386 = xor i64 %t385, %t384
+  %t387 = call i16 @llvm.fshr.i16(i16 %t215, i16 -127, i16 %t217)
+  %t388 = zext i16 %t387 to i64
+  %t389 = mul i64 %t386, 31
+  %t390 = xor i64 %t389, %t388
+  %t391 = sext i16 %t387 to i64
+  %t392 = mul i64 %t390, 31
+  %t393 = xor i64 %t392, %t391
+  %t394 = call i16 @llvm.smin.i16(i16 %t215, i16 %t216)
+  %t395 = zext i16 %t394 to i64
+  %t396 = mul i64 %t393, 31
+  %t397 = xor i64 %t396, %t395
+  %t398 = sext i16 %t394 to i64
+  %t399 = mul i64 %t397, 31
+  %t400 = xor i64 %t399, %t398
+  %t401 = call i16 @llvm.smin.i16(i16 %t216, i16 -5)
+  %t402 = zext i16 %t401 to i64
+  %t403 = mul i64 %t400, 31
+  %t404 = xor i64 %t403, %t402
+  %t405 = sext i16 %t401 to i64
+  %t406 = mul i64 %t404, 31
+  %t407 = xor i64 %t406, %t405
+  %t408 = call i16 @llvm.smax.i16(i16 %t215, i16 %t216)
+  %t409 = zext i16 %t408 to i64
+  %t410 = mul i64 %t407, 31
+  %t411 = xor i64 %t410, %t409
+  %t412 = sext i16 %t408 to i64
+  %t413 = mul i64 %t411, 31
+  %t414 = xor i64 %t413, %t412
+  %t415 = call i16 @llvm.smax.i16(i16 %t216, i16 -5)
+  %t416 = zext i16 %t415 to i64
+  %t417 = mul i64 %t414, 31
+  %t418 = xor i64 %t417, %t416
+  %t419 = sext i16 %t415 to i64
+  %t420 = mul i64 %t418, 31
+  %t421 = xor i64 %t420, %t419
+  %t422 = call i16 @llvm.umin.i16(i16 %t215, i16 %t216)
+  %t423 = zext i16 %t422 to i64
+  %t424 = mul i64 %t421, 31
+  %t425 = xor i64 %t424, %t423
+  %t426 = sext i16 %t422 to i64
+  %t427 = mul i64 %t425, 31
+  %t428 = xor i64 %t427, %t426
+  %t429 = call i16 @llvm.umin.i16(i16 %t216, i16 -5)
+  %t430 = zext i16 %t429 to i64
+  %t431 = mul i64 %t428, 31
+  %t432 = xor i64 %t431, %t430
+  %t433 = sext i16 %t429 to i64
+  %t434 = mul i64 %t432, 31
+  %t435 = xor i64 %t434, %t433
+  %t436 = call i16 @llvm.umax.i16(i16 %t215, i16 %t216)
+  %t437 = zext i16 %t436 to i64
+  %t438 = mul i64 %t435, 31
+  %t439 = xor i64 %t438, %t437
+  %t440 = sext i16 %t436 to i64
+  %t441 = mul i64 %t439, 31
+  %t442 = xor i64 %t441, %t440
+  %t443 = call i16 @llvm.umax.i16(i16 %t216, i16 -5)
+  %t444 = zext i16 %t443 to i64
+  %t445 = mul i64 %t442, 31
+  %t446 = xor i64 %t445, %t444
+  %t447 = sext i16 %t443 to i64
+  %t448 = mul i64 %t446, 31
+  %t449 = xor i64 %t448, %t447
+  ; i32
+  %t450 = trunc i64 %n to i32
+  %t451 = mul i32 %t450, -99
+  %t452 = add i32 %t450, 3
+  %t453 = or i32 %t452, 1
+  %t454 = call i32 @llvm.ctpop.i32(i32 %t450)
+  %t455 = zext i32 %t454 to i64
+  %t456 = mul i64 %t449, 31
+  %t457 = xor i64 %t456, %t455
+  %t458 = sext i32 %t454 to i64
+  %t459 = mul i64 %t457, 31
+  %t460 = xor i64 %t459, %t458
+  %t461 = call i32 @llvm.ctlz.i32(i32 %t450, i1 false)
+  %t462 = zext i32 %t461 to i64
+  %t463 = mul i64 %t460, 31
+  %t464 = xor i64 %t463, %t462
+  %t465 = sext i32 %t461 to i64
+  %t466 = mul i64 %t464, 31
+  %t467 = xor i64 %t466, %t465
+  %t468 = call i32 @llvm.cttz.i32(i32 %t450, i1 false)
+  %t469 = zext i32 %t468 to i64
+  %t470 = mul i64 %t467, 31
+  %t471 = xor i64 %t470, %t469
+  %t472 = sext i32 %t468 to i64
+  %t473 = mul i64 %t471, 31
+  %t474 = xor i64 %t473, %t472
+  %t475 = call i32 @llvm.bswap.i32(i32 %t450)
+  %t476 = zext i32 %t475 to i64
+  %t477 = mul i64 %t474, 31
+  %t478 = xor i64 %t477, %t476
+  %t479 = sext i32 %t475 to i64
+  %t480 = mul i64 %t478, 31
+  %t481 = xor i64 %t480, %t479
+  %t482 = call i32 @llvm.abs.i32(i32 %t450, i1 false)
+  %t483 = zext i32 %t482 to i64
+  %t484 = mul i64 %t481, 31
+  %t485 = xor i64 %t484, %t483
+  %t486 = sext i32 %t482 to i64
+  %t487 = mul i64 %t485, 31
+  %t488 = xor i64 %t487, %t486
+  %t489 = call i32 @llvm.ctpop.i32(i32 %t451)
+  %t490 = zext i32 %t489 to i64
+  %t491 = mul i64 %t488, 31
+  %t492 = xor i64 %t491, %t490
+  %t493 = sext i32 %t489 to i64
+  %t494 = mul i64 %t492, 31
+  %t495 = xor i64 %t494, %t493
+  %t496 = call i32 @llvm.ctlz.i32(i32 %t451, i1 false)
+  %t497 = zext i32 %t496 to i64
+  %t498 = mul i64 %t495, 31
+  %t499 = xor i64 %t498, %t497
+  %t500 = sext i32 %t496 to i64
+  %t501 = mul i64 %t499, 31
+  %t502 = xor i64 %t501, %t500
+  %t503 = call i32 @llvm.cttz.i32(i32 %t451, i1 false)
+  %t504 = zext i32 %t503 to i64
+  %t505 = mul i64 %t502, 31
+  %t506 = xor i64 %t505, %t504
+  %t507 = sext i32 %t503 to i64
+  %t508 = mul i64 %t506, 31
+  %t509 = xor i64 %t508, %t507
+  %t510 = call i32 @llvm.bswap.i32(i32 %t451)
+  %t511 = zext i32 %t510 to i64
+  %t512 = mul i64 %t509, 31
+  %t513 = xor i64 %t512, %t511
+  %t514 = sext i32 %t510 to i64
+  %t515 = mul i64 %t513, 31
+  %t516 = xor i64 %t515, %t514
+  %t517 = call i32 @llvm.abs.i32(i32 %t451, i1 false)
+  %t518 = zext i32 %t517 to i64
+  %t519 = mul i64 %t516, 31
+  %t520 = xor i64 %t519, %t518
+  %t521 = sext i32 %t517 to i64
+  %t522 = mul i64 %t520, 31
+  %t523 = xor i64 %t522, %t521
+  %t524 = call i32 @llvm.ctpop.i32(i32 -127)
+  %t525 = zext i32 %t524 to i64
+  %t526 = mul i64 %t523, 31
+  %t527 = xor i64 %t526, %t525
+  %t528 = sext i32 %t524 to i64
+  %t529 = mul i64 %t527, 31
+  %t530 = xor i64 %t529, %t528
+  %t531 = call i32 @llvm.ctlz.i32(i32 -127, i1 false)
+  %t532 = zext i32 %t531 to i64
+  %t533 = mul i64 %t530, 31
+  %t534 = xor i64 %t533, %t532
+  %t535 = sext i32 %t531 to i64
+  %t536 = mul i64 %t534, 31
+  %t537 = xor i64 %t536, %t535
+  %t538 = call i32 @llvm.cttz.i32(i32 -127, i1 false)
+  %t539 = zext i32 %t538 to i64
+  %t540 = mul i64 %t537, 31
+  %t541 = xor i64 %t540, %t539
+  %t542 = sext i32 %t538 to i64
+  %t543 = mul i64 %t541, 31
+  %t544 = xor i64 %t543, %t542
+  %t545 = call i32 @llvm.bswap.i32(i32 -127)
+  %t546 = zext i32 %t545 to i64
+  %t547 = mul i64 %t544, 31
+  %t548 = xor i64 %t547, %t546
+  %t549 = sext i32 %t545 to i64
+  %t550 = mul i64 %t548, 31
+  %t551 = xor i64 %t550, %t549
+  %t552 = call i32 @llvm.abs.i32(i32 -127, i1 false)
+  %t553 = zext i32 %t552 to i64
+  %t554 = mul i64 %t551, 31
+  %t555 = xor i64 %t554, %t553
+  %t556 = sext i32 %t552 to i64
+  %t557 = mul i64 %t555, 31
+  %t558 = xor i64 %t557, %t556
+  %t559 = call i32 @llvm.ctlz.i32(i32 %t453, i1 true)
+  %t560 = zext i32 %t559 to i64
+  %t561 = mul i64 %t558, 31
+  %t562 = xor i64 %t561, %t560
+  %t563 = sext i32 %t559 to i64
+  %t564 = mul i64 %t562, 31
+  %t565 = xor i64 %t564, %t563
+  %t566 = call i32 @llvm.abs.i32(i32 %t451, i1 true)
+  %t567 = zext i32 %t566 to i64
+  %t568 = mul i64 %t565, 31
+  %t569 = xor i64 %t568, %t567
+  %t570 = sext i32 %t566 to i64
+  %t571 = mul i64 %t569, 31
+  %t572 = xor i64 %t571, %t570
+  %t573 = call i32 @llvm.fshl.i32(i32 %t450, i32 %t451, i32 3)
+  %t574 = zext i32 %t573 to i64
+  %t575 = mul i64 %t572, 31
+  %t576 = xor i64 %t575, %t574
+  %t577 = sext i32 %t573 to i64
+  %t578 = mul i64 %t576, 31
+  %t579 = xor i64 %t578, %t577
+  %t580 = call i32 @llvm.fshl.i32(i32 %t451, i32 %t451, i32 %t452)
+  %t581 = zext i32 %t580 to i64
+  %t582 = mul i64 %t579, 31
+  %t583 = xor i64 %t582, %t581
+  %t584 = sext i32 %t580 to i64
+  %t585 = mul i64 %t583, 31
+  %t586 = xor i64 %t585, %t584
+  %t587 = call i32 @llvm.fshl.i32(i32 -127, i32 -127, i32 1)
+  %t588 = zext i32 %t587 to i64
+  %t589 = mul i64 %t586, 31
+  %t590 = xor i64 %t589, %t588
+  %t591 = sext i32 %t587 to i64
+  %t592 = mul i64 %t590, 31
+  %t593 = xor i64 %t592, %t591
+  %t594 = call i32 @llvm.fshl.i32(i32 %t450, i32 -127, i32 %t452)
+  %t595 = zext i32 %t594 to i64
+  %t596 = mul i64 %t593, 31
+  %t597 = xor i64 %t596, %t595
+  %t598 = sext i32 %t594 to i64
+  %t599 = mul i64 %t597, 31
+  %t600 = xor i64 %t599, %t598
+  %t601 = call i32 @llvm.fshr.i32(i32 %t450, i32 %t451, i32 3)
+  %t602 = zext i32 %t601 to i64
+  %t603 = mul i64 %t600, 31
+  %t604 = xor i64 %t603, %t602
+  %t605 = sext i32 %t601 to i64
+  %t606 = mul i64 %t604, 31
+  %t607 = xor i64 %t606, %t605
+  %t608 = call i32 @llvm.fshr.i32(i32 %t451, i32 %t451, i32 %t452)
+  %t609 = zext i32 %t608 to i64
+  %t610 = mul i64 %t607, 31
+  %t611 = xor i64 %t610, %t609
+  %t612 = sext i32 %t608 to i64
+  %t613 = mul i64 %t611, 31
+  %t614 = xor i64 %t613, %t612
+  %t615 = call i32 @llvm.fshr.i32(i32 -127, i32 -127, i32 1)
+  %t616 = zext i32 %t615 to i64
+  %t617 = mul i64 %t614, 31
+  %t618 = xor i64 %t617, %t616
+  %t619 = sext i32 %t615 to i64
+  %t620 = mul i64 %t618, 31
+  %t621 = xor i64 %t620, %t619
+  %t622 = call i32 @llvm.fshr.i32(i32 %t450, i32 -127, i32 %t452)
+  %t623 = zext i32 %t622 to i64
+  %t624 = mul i64 %t621, 31
+  %t625 = xor i64 %t624, %t623
+  %t626 = sext i32 %t622 to i64
+  %t627 = mul i64 %t625, 31
+  %t628 = xor i64 %t627, %t626
+  %t629 = call i32 @llvm.smin.i32(i32 %t450, i32 %t451)
+  %t630 = zext i32 %t629 to i64
+  %t631 = mul i64 %t628, 31
+  %t632 = xor i64 %t631, %t630
+  %t633 = sext i32 %t629 to i64
+  %t634 = mul i64 %t632, 31
+  %t635 = xor i64 %t634, %t633
+  %t636 = call i32 @llvm.smin.i32(i32 %t451, i32 -5)
+  %t637 = zext i32 %t636 to i64
+  %t638 = mul i64 %t635, 31
+  %t639 = xor i64 %t638, %t637
+  %t640 = sext i32 %t636 to i64
+  %t641 = mul i64 %t639, 31
+  %t642 = xor i64 %t641, %t640
+  %t643 = call i32 @llvm.smax.i32(i32 %t450, i32 %t451)
+  %t644 = zext i32 %t643 to i64
+  %t645 = mul i64 %t642, 31
+  %t646 = xor i64 %t645, %t644
+  %t647 = sext i32 %t643 to i64
+  %t648 = mul i64 %t646, 31
+  %t649 = xor i64 %t648, %t647
+  %t650 = call i32 @llvm.smax.i32(i32 %t451, i32 -5)
+  %t651 = zext i32 %t650 to i64
+  %t652 = mul i64 %t649, 31
+  %t653 = xor i64 %t652, %t651
+  %t654 = sext i32 %t650 to i64
+  %t655 = mul i64 %t653, 31
+  %t656 = xor i64 %t655, %t654
+  %t657 = call i32 @llvm.umin.i32(i32 %t450, i32 %t451)
+  %t658 = zext i32 %t657 to i64
+  %t659 = mul i64 %t656, 31
+  %t660 = xor i64 %t659, %t658
+  %t661 = sext i32 %t657 to i64
+  %t662 = mul i64 %t660, 31
+  %t663 = xor i64 %t662, %t661
+  %t664 = call i32 @llvm.umin.i32(i32 %t451, i32 -5)
+  %t665 = zext i32 %t664 to i64
+  %t666 = mul i64 %t663, 31
+  %t667 = xor i64 %t666, %t665
+  %t668 = sext i32 %t664 to i64
+  %t669 = mul i64 %t667, 31
+  %t670 = xor i64 %t669, %t668
+  %t671 = call i32 @llvm.umax.i32(i32 %t450, i32 %t451)
+  %t672 = zext i32 %t671 to i64
+  %t673 = mul i64 %t670, 31
+  %t674 = xor i64 %t673, %t672
+  %t675 = sext i32 %t671 to i64
+  %t676 = mul i64 %t674, 31
+  %t677 = xor i64 %t676, %t675
+  %t678 = call i32 @llvm.umax.i32(i32 %t451, i32 -5)
+  %t679 = zext i32 %t678 to i64
+  %t680 = mul i64 %t677, 31
+  %t681 = xor i64 %t680, %t679
+  %t682 = sext i32 %t678 to i64
+  %t683 = mul i64 %t681, 31
+  %t684 = xor i64 %t683, %t682
+  ; i64
+  %t685 = add i64 %n, 0
+  %t686 = mul i64 %t685, -99
+  %t687 = add i64 %t685, 3
+  %t688 = or i64 %t687, 1
+  %t689 = call i64 @llvm.ctpop.i64(i64 %t685)
+  %t690 = mul i64 %t684, 31
+  %t691 = xor i64 %t690, %t689
+  %t692 = call i64 @llvm.ctlz.i64(i64 %t685, i1 false)
+  %t693 = mul i64 %t691, 31
+  %t694 = xor i64 %t693, %t692
+  %t695 = call i64 @llvm.cttz.i64(i64 %t685, i1 false)
+  %t696 = mul i64 %t694, 31
+  %t697 = xor i64 %t696, %t695
+  %t698 = call i64 @llvm.bswap.i64(i64 %t685)
+  %t699 = mul i64 %t697, 31
+  %t700 = xor i64 %t699, %t698
+  %t701 = call i64 @llvm.abs.i64(i64 %t685, i1 false)
+  %t702 = mul i64 %t700, 31
+  %t703 = xor i64 %t702, %t701
+  %t704 = call i64 @llvm.ctpop.i64(i64 %t686)
+  %t705 = mul i64 %t703, 31
+  %t706 = xor i64 %t705, %t704
+  %t707 = call i64 @llvm.ctlz.i64(i64 %t686, i1 false)
+  %t708 = mul i64 %t706, 31
+  %t709 = xor i64 %t708, %t707
+  %t710 = call i64 @llvm.cttz.i64(i64 %t686, i1 false)
+  %t711 = mul i64 %t709, 31
+  %t712 = xor i64 %t711, %t710
+  %t713 = call i64 @llvm.bswap.i64(i64 %t686)
+  %t714 = mul i64 %t712, 31
+  %t715 = xor i64 %t714, %t713
+  %t716 = call i64 @llvm.abs.i64(i64 %t686, i1 false)
+  %t717 = mul i64 %t715, 31
+  %t718 = xor i64 %t717, %t716
+  %t719 = call i64 @llvm.ctpop.i64(i64 -127)
+  %t720 = mul i64 %t718, 31
+  %t721 = xor i64 %t720, %t719
+  %t722 = call i64 @llvm.ctlz.i64(i64 -127, i1 false)
+  %t723 = mul i64 %t721, 31
+  %t724 = xor i64 %t723, %t722
+  %t725 = call i64 @llvm.cttz.i64(i64 -127, i1 false)
+  %t726 = mul i64 %t724, 31
+  %t727 = xor i64 %t726, %t725
+  %t728 = call i64 @llvm.bswap.i64(i64 -127)
+  %t729 = mul i64 %t727, 31
+  %t730 = xor i64 %t729, %t728
+  %t731 = call i64 @llvm.abs.i64(i64 -127, i1 false)
+  %t732 = mul i64 %t730, 31
+  %t733 = xor i64 %t732, %t731
+  %t734 = call i64 @llvm.ctlz.i64(i64 %t688, i1 true)
+  %t735 = mul i64 %t733, 31
+  %t736 = xor i64 %t735, %t734
+  %t737 = call i64 @llvm.abs.i64(i64 %t686, i1 true)
+  %t738 = mul i64 %t736, 31
+  %t739 = xor i64 %t738, %t737
+  %t740 = call i64 @llvm.fshl.i64(i64 %t685, i64 %t686, i64 3)
+  %t741 = mul i64 %t739, 31
+  %t742 = xor i64 %t741, %t740
+  %t743 = call i64 @llvm.fshl.i64(i64 %t686, i64 %t686, i64 %t687)
+  %t744 = mul i64 %t742, 31
+  %t745 = xor i64 %t744, %t743
+  %t746 = call i64 @llvm.fshl.i64(i64 -127, i64 -127, i64 1)
+  %t747 = mul i64 %t745, 31
+  %t748 = xor i64 %t747, %t746
+  %t749 = call i64 @llvm.fshl.i64(i64 %t685, i64 -127, i64 %t687)
+  %t750 = mul i64 %t748, 31
+  %t751 = xor i64 %t750, %t749
+  %t752 = call i64 @llvm.fshr.i64(i64 %t685, i64 %t686, i64 3)
+  %t753 = mul i64 %t751, 31
+  %t754 = xor i64 %t753, %t752
+  %t755 = call i64 @llvm.fshr.i64(i64 %t686, i64 %t686, i64 %t687)
+  %t756 = mul i64 %t754, 31
+  %t757 = xor i64 %t756, %t755
+  %t758 = call i64 @llvm.fshr.i64(i64 -127, i64 -127, i64 1)
+  %t759 = mul i64 %t757, 31
+  %t760 = xor i64 %t759, %t758
+  %t761 = call i64 @llvm.fshr.i64(i64 %t685, i64 -127, i64 %t687)
+  %t762 = mul i64 %t760, 31
+  %t763 = xor i64 %t762, %t761
+  %t764 = call i64 @llvm.smin.i64(i64 %t685, i64 %t686)
+  %t765 = mul i64 %t763, 31
+  %t766 = xor i64 %t765, %t764
+  %t767 = call i64 @llvm.smin.i64(i64 %t686, i64 -5)
+  %t768 = mul i64 %t766, 31
+  %t769 = xor i64 %t768, %t767
+  %t770 = call i64 @llvm.smax.i64(i64 %t685, i64 %t686)
+  %t771 = mul i64 %t769, 31
+  %t772 = xor i64 %t771, %t770
+  %t773 = call i64 @llvm.smax.i64(i64 %t686, i64 -5)
+  %t774 = mul i64 %t772, 31
+  %t775 = xor i64 %t774, %t773
+  %t776 = call i64 @llvm.umin.i64(i64 %t685, i64 %t686)
+  %t777 = mul i64 %t775, 31
+  %t778 = xor i64 %t777, %t776
+  %t779 = call i64 @llvm.umin.i64(i64 %t686, i64 -5)
+  %t780 = mul i64 %t778, 31
+  %t781 = xor i64 %t780, %t779
+  %t782 = call i64 @llvm.umax.i64(i64 %t685, i64 %t686)
+  %t783 = mul i64 %t781, 31
+  %t784 = xor i64 %t783, %t782
+  %t785 = call i64 @llvm.umax.i64(i64 %t686, i64 -5)
+  %t786 = mul i64 %t784, 31
+  %t787 = xor i64 %t786, %t785
+  %fold = lshr i64 %t787, 32
+  %res64 = xor i64 %t787, %fold
+  %res = trunc i64 %res64 to i32
+  %ret = and i32 %res, 255
+  ret i32 %ret
+}
+
+declare i32 @atoi(i8*)
+declare i16 @llvm.abs.i16(i16, i1)
+declare i16 @llvm.bswap.i16(i16)
+declare i16 @llvm.ctlz.i16(i16, i1)
+declare i16 @llvm.ctpop.i16(i16)
+declare i16 @llvm.cttz.i16(i16, i1)
+declare i16 @llvm.fshl.i16(i16, i16, i16)
+declare i16 @llvm.fshr.i16(i16, i16, i16)
+declare i16 @llvm.smax.i16(i16, i16)
+declare i16 @llvm.smin.i16(i16, i16)
+declare i16 @llvm.umax.i16(i16, i16)
+declare i16 @llvm.umin.i16(i16, i16)
+declare i32 @llvm.abs.i32(i32, i1)
+declare i32 @llvm.bswap.i32(i32)
+declare i32 @llvm.ctlz.i32(i32, i1)
+declare i32 @llvm.ctpop.i32(i32)
+declare i32 @llvm.cttz.i32(i32, i1)
+declare i32 @llvm.fshl.i32(i32, i32, i32)
+declare i32 @llvm.fshr.i32(i32, i32, i32)
+declare i32 @llvm.smax.i32(i32, i32)
+declare i32 @llvm.smin.i32(i32, i32)
+declare i32 @llvm.umax.i32(i32, i32)
+declare i32 @llvm.umin.i32(i32, i32)
+declare i64 @llvm.abs.i64(i64, i1)
+declare i64 @llvm.bswap.i64(i64)
+declare i64 @llvm.ctlz.i64(i64, i1)
+declare i64 @llvm.ctpop.i64(i64)
+declare i64 @llvm.cttz.i64(i64, i1)
+declare i64 @llvm.fshl.i64(i64, i64, i64)
+declare i64 @llvm.fshr.i64(i64, i64, i64)
+declare i64 @llvm.smax.i64(i64, i64)
+declare i64 @llvm.smin.i64(i64, i64)
+declare i64 @llvm.umax.i64(i64, i64)
+declare i64 @llvm.umin.i64(i64, i64)
+declare i8 @llvm.abs.i8(i8, i1)
+declare i8 @llvm.ctlz.i8(i8, i1)
+declare i8 @llvm.ctpop.i8(i8)
+declare i8 @llvm.cttz.i8(i8, i1)
+declare i8 @llvm.fshl.i8(i8, i8, i8)
+declare i8 @llvm.fshr.i8(i8, i8, i8)
+declare i8 @llvm.smax.i8(i8, i8)
+declare i8 @llvm.smin.i8(i8, i8)
+declare i8 @llvm.umax.i8(i8, i8)
+declare i8 @llvm.umin.i8(i8, i8)
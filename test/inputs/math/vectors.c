@@ -0,0 +1,34 @@
+#include <stdlib.h>
+
+typedef int v4si __attribute__((vector_size(16)));
+typedef unsigned v4su __attribute__((vector_size(16)));
+typedef float v4sf __attribute__((vector_size(16)));
+typedef long v2sl __attribute__((vector_size(16)));
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        return -1;
+    }
+
+    int n = atoi(argv[1]);
+
+    v4si a = { n, n * 2, -n, 7 };
+    v4si b = { 3, -3, n | 1, n * n + 1 };
+    a[3] = n + 5;
+
+    v4si sum = a + b;
+    v4si quot = a / b;
+    v4si shifted = a >> 1;
+    v4su logical = (v4su)a >> 1;
+    v4si less = a < b;
+    v4si blend = (a & less) | (b & ~less);
+
+    v4sf f = __builtin_convertvector(sum, v4sf) * 0.5f;
+    v4si back = __builtin_convertvector(f, v4si);
+    v4si reversed = __builtin_shufflevector(back, blend, 3, 2, 5, 4);
+    v2sl wide = __builtin_convertvector(__builtin_shufflevector(quot, quot, 0, 1), v2sl);
+
+    int result = reversed[0] + reversed[1] + reversed[2] + reversed[3];
+    result += (int)(wide[0] - wide[1]) + shifted[2] + (int)(logical[2] & 0xff);
+    return result & 0x7f;
+}
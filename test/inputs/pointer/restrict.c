@@ -0,0 +1,26 @@
+#include <stdlib.h>
+
+void add(long* restrict dst, const long* restrict src, int n) {
+	for (int i = 0; i < n; i++) {
+		dst[i] += src[i];
+	}
+}
+
+int main(int argc, char** argv) {
+	if (argc != 2) {
+		return -1;
+	}
+
+	char *p;
+	long num = strtol(argv[1], &p, 10);
+
+	if (*p != '\0') {
+		return -1;
+	}
+
+	long a[3] = {num, 1, 2};
+	long b[3] = {3, num, 4};
+	add(a, b, 3);
+
+	return a[0] + a[1] - a[2];
+}
@@ -0,0 +1,53 @@
+#include <stdlib.h>
+
+int counter;
+unsigned char flags = 0xff;
+int* owner;
+
+#ifndef __clang__
+static int __atomic_fetch_max(int* ptr, int value, int order) {
+    int old = __atomic_load_n(ptr, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(ptr, &old, old > value ? old : value, 0, order, __ATOMIC_RELAXED)) {
+    }
+    return old;
+}
+
+static unsigned __atomic_fetch_min(unsigned* ptr, unsigned value, int order) {
+    unsigned old = __atomic_load_n(ptr, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(ptr, &old, old < value ? old : value, 0, order, __ATOMIC_RELAXED)) {
+    }
+    return old;
+}
+#endif
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        return -1;
+    }
+
+    int n = atoi(argv[1]);
+    __atomic_store_n(&counter, n, __ATOMIC_RELEASE);
+
+    int result = __atomic_fetch_add(&counter, 3, __ATOMIC_ACQ_REL);
+    result += __atomic_exchange_n(&counter, n * 2, __ATOMIC_RELAXED);
+    __atomic_fetch_sub(&counter, 1, __ATOMIC_SEQ_CST);
+    result += __atomic_fetch_nand(&flags, (unsigned char)n, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    result += __atomic_fetch_max(&counter, -n, __ATOMIC_SEQ_CST);
+    result += __atomic_fetch_min((unsigned*)&counter, (unsigned)n, __ATOMIC_ACQUIRE);
+
+    int expected = n;
+    if (__atomic_compare_exchange_n(&counter, &expected, 7, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        result += 1;
+    }
+    result += expected;
+
+    int* none = NULL;
+    if (__atomic_compare_exchange_n(&owner, &none, &counter, 1, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+        result += *owner;
+    }
+
+    result += __atomic_load_n(&counter, __ATOMIC_ACQUIRE) + __atomic_load_n(&flags, __ATOMIC_SEQ_CST);
+
+    return result & 0x7f;
+}
@@ -0,0 +1,39 @@
+#include <stdlib.h>
+
+#define N 65536
+
+unsigned char data[N];
+
+static unsigned fnv1a(const unsigned char* p, int n) {
+	unsigned h = 2166136261u;
+	for (int i = 0; i < n; i++) {
+		h ^= p[i];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+static unsigned long long mix(unsigned long long x) {
+	x ^= x >> 33;
+	x *= 0xff51afd7ed558ccdULL;
+	x ^= x >> 33;
+	x *= 0xc4ceb9fe1a85ec53ULL;
+	x ^= x >> 33;
+	return x;
+}
+
+int main(int argc, char** argv) {
+	int rounds = argc > 1 ? atoi(argv[1]) : 2000;
+
+	for (int i = 0; i < N; i++) {
+		data[i] = (unsigned char) (i * 31 + (i >> 8));
+	}
+
+	unsigned long long acc = 0;
+	for (int r = 0; r < rounds; r++) {
+		acc += mix(fnv1a(data, N) + r);
+		data[r % N] ^= (unsigned char) acc;
+	}
+
+	return (int) (acc % 256);
+}
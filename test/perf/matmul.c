@@ -0,0 +1,37 @@
+#include <stdlib.h>
+
+#define N 192
+
+double a[N][N];
+double b[N][N];
+double c[N][N];
+
+int main(int argc, char** argv) {
+	int rounds = argc > 1 ? atoi(argv[1]) : 20;
+
+	for (int i = 0; i < N; i++) {
+		for (int j = 0; j < N; j++) {
+			a[i][j] = (i * j % 7) / 3.0;
+			b[i][j] = (i + j % 5) / 7.0;
+		}
+	}
+
+	for (int r = 0; r < rounds; r++) {
+		for (int i = 0; i < N; i++) {
+			for (int j = 0; j < N; j++) {
+				double sum = 0;
+				for (int k = 0; k < N; k++) {
+					sum += a[i][k] * b[k][j];
+				}
+				c[i][j] = sum + r;
+			}
+		}
+	}
+
+	double trace = 0;
+	for (int i = 0; i < N; i++) {
+		trace += c[i][i];
+	}
+
+	return (int) trace % 256;
+}
@@ -0,0 +1,27 @@
+#include <stdlib.h>
+#include <string.h>
+
+#define N 4000000
+
+char composite[N];
+
+int main(int argc, char** argv) {
+	int rounds = argc > 1 ? atoi(argv[1]) : 10;
+	int count = 0;
+
+	for (int r = 0; r < rounds; r++) {
+		memset(composite, 0, sizeof(composite));
+		count = 0;
+
+		for (long i = 2; i < N; i++) {
+			if (!composite[i]) {
+				count++;
+				for (long j = i * i; j < N; j += i) {
+					composite[j] = 1;
+				}
+			}
+		}
+	}
+
+	return count % 256;
+}
@@ -0,0 +1,56 @@
+#include <stdlib.h>
+
+#define N 4000
+
+struct point {
+	int x;
+	int y;
+	long weight;
+	char tag[8];
+};
+
+struct point points[N];
+
+static long distance(struct point a, struct point b) {
+	long dx = a.x - b.x;
+	long dy = a.y - b.y;
+	return dx * dx + dy * dy;
+}
+
+int main(int argc, char** argv) {
+	int rounds = argc > 1 ? atoi(argv[1]) : 40;
+	unsigned seed = 12345;
+
+	for (int i = 0; i < N; i++) {
+		seed = seed * 1103515245 + 12345;
+		points[i].x = seed % 1000;
+		seed = seed * 1103515245 + 12345;
+		points[i].y = seed % 1000;
+		points[i].weight = i;
+		points[i].tag[0] = 'a' + i % 26;
+	}
+
+	long total = 0;
+	for (int r = 0; r < rounds; r++) {
+		// insertion sort by x, copying whole structs
+		for (int i = 1; i < N; i++) {
+			struct point p = points[i];
+			int j = i - 1;
+			while (j >= 0 && points[j].x > p.x) {
+				points[j + 1] = points[j];
+				j--;
+			}
+			points[j + 1] = p;
+		}
+
+		for (int i = 1; i < N; i++) {
+			total += distance(points[i - 1], points[i]) + points[i].tag[0];
+		}
+
+		for (int i = 0; i < N; i++) {
+			points[i].x = (points[i].x * 7 + r) % 1000;
+		}
+	}
+
+	return total % 256;
+}
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+
+"""
+Compares speed of the original programs in perf/ with their translations by llvm2c.
+Both are compiled with clang -O2, run repeatedly and the fastest runs are compared.
+Fails if any translated program is slower than the original by more than the threshold.
+"""
+
+import argparse, glob, os, shutil, tempfile, time
+from subprocess import run, DEVNULL, PIPE
+
+parser = argparse.ArgumentParser(description=__doc__)
+parser.add_argument('programs', nargs='*', help='programs to compare (default: perf/*.c)')
+parser.add_argument('-r', '--repeat', type=int, default=5, help='number of runs of every binary, the fastest one is used')
+parser.add_argument('-t', '--threshold', type=float, default=1.25, help='maximal allowed ratio of time of the translated and the original program')
+parser.add_argument('--cflags', default='-O2', help='flags used to compile both the original and the translated program')
+args = parser.parse_args()
+
+
+def compile_c(source, binary):
+    proc = run(['clang'] + args.cflags.split() + ['-w', source, '-o', binary, '-lm'], stdout=DEVNULL, stderr=PIPE, universal_newlines=True)
+    if proc.returncode != 0:
+        raise RuntimeError('clang could not compile %s:\n%s' % (source, proc.stderr))
+
+
+def measure(binary):
+    """Returns the exit code and the fastest wall-clock time of the binary."""
+    best = None
+    code = None
+    for _ in range(args.repeat):
+        start = time.perf_counter()
+        code = run([binary], stdout=DEVNULL).returncode
+        elapsed = time.perf_counter() - start
+        best = elapsed if best is None else min(best, elapsed)
+    return code, best
+
+
+def compare(program, tempdir):
+    name = os.path.splitext(os.path.basename(program))[0]
+    ll = os.path.join(tempdir, name + '.ll')
+    translated = os.path.join(tempdir, name + '.c')
+
+    compile_c(program, os.path.join(tempdir, 'orig'))
+
+    # the same input as in ./run, so that the measured code is what llvm2c sees in the tests
+    if run(['clang', program, '-g', '-emit-llvm', '-S', '-Xclang', '-disable-O0-optnone', '-o', ll], stdout=DEVNULL, stderr=DEVNULL).returncode != 0:
+        raise RuntimeError('clang could not translate %s to LLVM' % program)
+    if run(['./llvm2c', ll, '-o', translated], stdout=DEVNULL, stderr=DEVNULL).returncode != 0:
+        raise RuntimeError('llvm2c failed to translate %s' % program)
+    compile_c(translated, os.path.join(tempdir, 'new'))
+
+    orig_code, orig_time = measure(os.path.join(tempdir, 'orig'))
+    new_code, new_time = measure(os.path.join(tempdir, 'new'))
+    if orig_code != new_code:
+        raise RuntimeError('translated %s returned %d instead of %d' % (program, new_code, orig_code))
+
+    return orig_time, new_time
+
+
+def main():
+    if not os.path.exists('llvm2c'):
+        print('llvm2c not found!')
+        return 1
+
+    programs = args.programs or sorted(glob.glob('perf/*.c'))
+    failed = 0
+    tempdir = tempfile.mkdtemp()
+
+    print('%-24s %10s %10s %8s' % ('program', 'orig [s]', 'new [s]', 'ratio'))
+    try:
+        for program in programs:
+            try:
+                orig_time, new_time = compare(program, tempdir)
+            except RuntimeError as e:
+                print('%-24s [NOK] %s' % (program, e))
+                failed += 1
+                continue
+
+            ratio = new_time / orig_time
+            ok = ratio <= args.threshold
+            print('%-24s %10.3f %10.3f %8.2f %s' % (program, orig_time, new_time, ratio, '[OK ]' if ok else '[NOK]'))
+            if not ok:
+                failed += 1
+    finally:
+        shutil.rmtree(tempdir)
+
+    if failed == 0:
+        print('All perf tests passed!')
+    else:
+        print('%d perf tests failed!' % failed)
+
+    return failed
+
+
+if __name__ == '__main__':
+    exit(main())
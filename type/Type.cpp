@@ -3,24 +3,28 @@
 #include "llvm/IR/DerivedTypes.h"
 #include "llvm/Support/raw_ostream.h"
 
-FunctionPointerType::FunctionPointerType(const std::string& type, const std::string& name, const std::string& typeEnd)
+size_t Type::liveCount[Type::TK_KindCount] = {};
+
+FunctionPointerType::FunctionPointerType(const std::string& name, Type* returnType, const std::vector<Type*>& params, bool isVarArg)
     : Type(TK_FunctionPointerType),
-      type(type),
       name(name),
-      typeEnd(typeEnd) { }
+      returnType(returnType),
+      params(params),
+      isVarArg(isVarArg) { }
 
 FunctionPointerType::FunctionPointerType(const FunctionPointerType& other)
     : Type(TK_FunctionPointerType) {
-    type = other.type;
     name = other.name;
-    typeEnd = other.typeEnd;
+    returnType = other.returnType;
+    params = other.params;
+    isVarArg = other.isVarArg;
 }
 
 void FunctionPointerType::print() const {
     llvm::outs() << toString();
 }
 
-std::string FunctionPointerType::toString() const {
+std::string FunctionPointerType::createString() const {
     return name;
 }
 
@@ -28,12 +32,50 @@ bool FunctionPointerType::classof(const Type* type) {
     return type->getKind() == TK_FunctionPointerType;
 }
 
-std::string FunctionPointerType::defToString() const {
-    if (typeEnd.empty()) {
-        return "typedef " + type + " " + name + ";";
+std::string FunctionPointerType::typeToString() const {
+    return returnType->toString() + "(*";
+}
+
+std::string FunctionPointerType::typeEndToString() const {
+    std::string ret = ")(";
+
+    if (params.empty()) {
+        return ret + "void)";
     }
 
-    return "typedef " + type + name + typeEnd + ";";
+    bool first = true;
+    for (auto* paramType : params) {
+        if (!first) {
+            ret += ", ";
+        }
+        first = false;
+
+        ret += paramType->toString();
+
+        if (auto PT = llvm::dyn_cast_or_null<PointerType>(paramType)) {
+            if (PT->isArrayPointer) {
+                ret += " (";
+                for (unsigned i = 0; i < PT->levels; i++) {
+                    ret += "*";
+                }
+                ret += ")" + PT->sizes;
+            }
+        }
+
+        if (auto AT = llvm::dyn_cast_or_null<ArrayType>(paramType)) {
+            ret += AT->sizeToString();
+        }
+    }
+
+    if (isVarArg) {
+        ret += ", ...";
+    }
+
+    return ret + ")";
+}
+
+std::string FunctionPointerType::defToString() const {
+    return "typedef " + typeToString() + name + typeEndToString() + ";";
 }
 
 AggregateType::AggregateType(TypeKind kind, const std::string& name): Type(kind), name(name) { }
@@ -57,7 +99,7 @@ bool StructType::classof(const Type* type) {
     return type->getKind() == TK_StructType;
 }
 
-std::string StructType::toString() const {
+std::string StructType::createString() const {
     std::string ret = getConstStaticString();
 
     return ret + "struct " + name;
@@ -81,7 +123,7 @@ unsigned UnionType::indexOfType(Type* type) const {
     abort();
 }
 
-std::string UnionType::toString() const {
+std::string UnionType::createString() const {
     std::string ret = getConstStaticString();
     return ret + "union " + name;
 }
@@ -114,6 +156,11 @@ ArrayType::ArrayType(Type* type, unsigned int size)
         isPointerArray = true;
         pointer = PT;
     }
+
+    sizes = "[" + std::to_string(size) + "]";
+    if (auto AT = llvm::dyn_cast_or_null<ArrayType>(this->type)) {
+        sizes += AT->sizes;
+    }
 }
 
 ArrayType::ArrayType(const ArrayType& other): Type(TK_ArrayType) {
@@ -123,6 +170,7 @@ ArrayType::ArrayType(const ArrayType& other): Type(TK_ArrayType) {
     structName = other.structName;
     isPointerArray = other.isPointerArray;
     pointer = other.pointer;
+    sizes = other.sizes;
 }
 
 void ArrayType::print() const {
@@ -137,23 +185,14 @@ bool ArrayType::classof(const Type* type) {
     return type->getKind() == TK_ArrayType;
 }
 
-std::string ArrayType::toString() const {
+std::string ArrayType::createString() const {
     std::string ret = getConstStaticString();
 
     return ret + type->toString();
 }
 
-std::string ArrayType::sizeToString() const {
-    std::string ret;
-
-    ret += "[";
-    ret += std::to_string(size);
-    ret += "]";
-    if (ArrayType* AT = llvm::dyn_cast_or_null<ArrayType>(type)) {
-        ret += AT->sizeToString();
-    }
-
-    return ret;
+const std::string& ArrayType::sizeToString() const {
+    return sizes;
 }
 
 std::string ArrayType::surroundName(const std::string& name) {
@@ -169,13 +208,36 @@ std::string ArrayType::surroundName(const std::string& name) {
     }
 }
 
+VectorType::VectorType(const std::string& name, Type* elementType, unsigned size, unsigned elementSize)
+    : Type(TK_VectorType),
+      name(name),
+      elementType(elementType),
+      size(size),
+      elementSize(elementSize) { }
+
+void VectorType::print() const {
+    llvm::outs() << toString();
+}
+
+std::string VectorType::attributesToString() const {
+    return " __attribute__((vector_size(" + std::to_string(size * elementSize) + "), aligned(" + std::to_string(elementSize) + ")))";
+}
+
+bool VectorType::classof(const Type* type) {
+    return type->getKind() == TK_VectorType;
+}
+
+std::string VectorType::createString() const {
+    return getConstStaticString() + name;
+}
+
 VoidType::VoidType(): Type(TK_VoidType) {}
 
 void VoidType::print() const {
     llvm::outs() << toString();
 }
 
-std::string VoidType::toString() const {
+std::string VoidType::createString() const {
     return "void";
 }
 
@@ -227,7 +289,7 @@ bool PointerType::classof(const Type* type) {
     return type->getKind() == TK_PointerType;
 }
 
-std::string PointerType::toString() const {
+std::string PointerType::createString() const {
     std::string ret = getConstStaticString();
 
     if (isArrayPointer) {
@@ -287,7 +349,7 @@ bool IntegerType::classof(const Type* type) {
         || type->getKind() == TK_Int128;
 }
 
-std::string IntegerType::toString() const {
+std::string IntegerType::createString() const {
     std::string ret = getConstStaticString();
 
     if (unsignedType) {
@@ -354,7 +416,7 @@ void FloatingPointType::print() const {
     llvm::outs() << toString();
 }
 
-std::string FloatingPointType::toString() const {
+std::string FloatingPointType::createString() const {
     std::string ret = getConstStaticString();
 
     return ret + name;
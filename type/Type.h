@@ -4,6 +4,7 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 /**
  * @brief The Type class is an abstract class for all types.
@@ -16,6 +17,7 @@ public:
         TK_UnionType,
         TK_PointerType,
         TK_ArrayType,
+        TK_VectorType,
         TK_VoidType,
         TK_IntegerType,
         TK_CharType,
@@ -27,15 +29,45 @@ public:
         TK_FloatType,
         TK_DoubleType,
         TK_LongDoubleType,
+
+        TK_KindCount // number of kinds, must stay last
     };
 private:
     const TypeKind kind;
+
+    mutable std::string spelling; //cached result of toString
+    mutable bool hasSpelling = false;
+
+    // number of existing types of every kind, reported by --mem-stats
+    static size_t liveCount[TK_KindCount];
+
+protected:
+    /**
+     * @brief createString Creates C spelling of the type, called only once by toString.
+     */
+    virtual std::string createString() const = 0;
+
 public:
 
-    Type(TypeKind kind): kind(kind) {}
-    virtual ~Type() = default;
+    Type(TypeKind kind): kind(kind) { liveCount[kind]++; }
+    Type(const Type& other): kind(other.kind), spelling(other.spelling), hasSpelling(other.hasSpelling), isConst(other.isConst) { liveCount[kind]++; }
+    virtual ~Type() { liveCount[kind]--; }
+
+    static size_t getLiveCount(TypeKind kind) { return liveCount[kind]; }
     virtual void print() const = 0;
-    virtual std::string toString() const = 0;
+
+    /**
+     * @brief toString Returns C spelling of the type. Types are immutable after construction,
+     * so the spelling is created only on the first call.
+     */
+    const std::string& toString() const {
+        if (!hasSpelling) {
+            spelling = createString();
+            hasSpelling = true;
+        }
+
+        return spelling;
+    }
 
     bool isConst = false;
 
@@ -67,17 +99,26 @@ public:
 class FunctionPointerType : public Type {
 friend class TypeHandler;
 public:
-    //type is split into two string so the name can be printed separately
-    std::string type;
     std::string name;
-    std::string typeEnd;
+    Type* returnType;
+    std::vector<Type*> params; //types of parameters
+    bool isVarArg;
 
 public:
-    FunctionPointerType(const std::string&, const std::string&, const std::string&);
+    FunctionPointerType(const std::string&, Type*, const std::vector<Type*>&, bool);
     FunctionPointerType(const FunctionPointerType&);
 
     void print() const override;
-    std::string toString() const override;
+
+    /**
+     * @brief typeToString Returns part of the definition in front of the typedef name, e.g. "int(*".
+     */
+    std::string typeToString() const;
+
+    /**
+     * @brief typeEndToString Returns part of the definition after the typedef name, e.g. ")(int, char*)".
+     */
+    std::string typeEndToString() const;
 
     /**
      * @brief defToString Returns definition of FunctionPointerType as a typedef string.
@@ -86,6 +127,9 @@ public:
     std::string defToString() const;
 
     static bool classof(const Type* type);
+
+protected:
+    std::string createString() const override;
 };
 
 class AggregateType : public Type {
@@ -111,9 +155,11 @@ public:
     StructType(const StructType&);
 
     void print() const override;
-    std::string toString() const override;
 
     static bool classof(const Type* type);
+
+protected:
+    std::string createString() const override;
 };
 
 /**
@@ -124,11 +170,13 @@ public:
     UnionType(const std::string&);
 
     void print() const override;
-    std::string toString() const override;
 
     unsigned indexOfType(Type* type) const;
 
     static bool classof(const Type* type);
+
+protected:
+    std::string createString() const override;
 };
 
 
@@ -150,11 +198,13 @@ public:
     PointerType(const PointerType& other);
 
     void print() const override;
-    std::string toString() const override;
 
     std::string surroundName(const std::string& name) override;
 
     static bool classof(const Type* type);
+
+protected:
+    std::string createString() const override;
 };
 
 /**
@@ -171,18 +221,49 @@ public:
     bool isPointerArray; //indicates whether the array contains pointers
     PointerType* pointer; //pointers contained in array
 
+    std::string sizes; //sizes of this array and nested arrays, e.g. [2][3]
+
     ArrayType(Type*, unsigned int);
     ArrayType(const ArrayType&);
 
     void print() const override;
-    std::string toString() const override;
 
     void printSize() const;
-    std::string sizeToString() const;
+    const std::string& sizeToString() const;
 
     std::string surroundName(const std::string& name) override;
 
     static bool classof(const Type* type);
+
+protected:
+    std::string createString() const override;
+};
+
+/**
+ * @brief The VectorType class represents LLVM vector. It is written as typedef
+ * using GCC vector extension, e.g. typedef float typeDef_0 __attribute__((vector_size(16), aligned(4)));
+ */
+class VectorType : public Type {
+public:
+    std::string name;
+    Type* elementType;
+    unsigned size; //number of elements
+    unsigned elementSize; //size of one element in bytes
+
+    VectorType(const std::string&, Type*, unsigned, unsigned);
+
+    void print() const override;
+
+    /**
+     * @brief attributesToString Returns part of the definition after the typedef name.
+     * Vectors are aligned only as their elements, because LLVM loads them also from arrays of the elements.
+     */
+    std::string attributesToString() const;
+
+    static bool classof(const Type* type);
+
+protected:
+    std::string createString() const override;
 };
 
 /**
@@ -192,9 +273,11 @@ class VoidType : public Type {
 public:
     VoidType();
     void print() const override;
-    std::string toString() const override;
 
     static bool classof(const Type* type);
+
+protected:
+    std::string createString() const override;
 };
 
 /**
@@ -212,9 +295,11 @@ public:
     IntegerType(const IntegerType&);
 
     void print() const override;
-    std::string toString() const override;
 
     static bool classof(const Type* type);
+
+protected:
+    std::string createString() const override;
 };
 
 /**
@@ -285,9 +370,11 @@ public:
     FloatingPointType(const FloatingPointType&);
 
     void print() const override;
-    std::string toString() const override;
 
     static bool classof(const Type* type);
+
+protected:
+    std::string createString() const override;
 };
 
 /**
@@ -4,9 +4,12 @@
 
 #include "../core/Program.h"
 
+#include <algorithm>
+
 Type* TypeHandler::getType(const llvm::Type* type) {
-    if (typeDefs.find(type) != typeDefs.end()) {
-        return typeDefs[type].get();
+    auto td = typeDefs.find(type);
+    if (td != typeDefs.end()) {
+        return td->second;
     }
 
     auto it = typeCache.find(type);
@@ -67,57 +70,17 @@ Type* TypeHandler::getType(const llvm::Type* type) {
         const llvm::PointerType* PT = llvm::cast<const llvm::PointerType>(type);
 
         if (const llvm::FunctionType* FT = llvm::dyn_cast_or_null<llvm::FunctionType>(PT->getPointerElementType())) {
-            std::vector<std::string> params;
-            if (FT->getNumParams() == 0) {
-                params.push_back("void");
-            } else {
-                std::string param;
-                //parsing params to string
-                for (unsigned i = 0; i < FT->getNumParams(); i++) {
-                    auto paramType = getType(FT->getParamType(i));
-                    param = paramType->toString();
-
-                    if (auto PT = llvm::dyn_cast_or_null<PointerType>(paramType)) {
-                        if (PT->isArrayPointer) {
-                            param += " (";
-                            for (unsigned i = 0; i < PT->levels; i++) {
-                                param += "*";
-                            }
-                            param += ")" + PT->sizes;
-                        }
-                    }
-
-                    if (auto AT = llvm::dyn_cast_or_null<ArrayType>(paramType)) {
-                        param += AT->sizeToString();
-                    }
-
-                    params.push_back(param);
-                }
-
-                if (FT->isVarArg()) {
-                    params.push_back("...");
-                }
-            }
-
-            std::string paramsToString = "(";
-            bool first = true;
-            for (const auto& param : params) {
-                if (!first) {
-                    paramsToString += ", ";
-                }
-                first = false;
-
-                paramsToString += param;
-            }
-            paramsToString += ")";
-
-            typeDefs[type] = std::make_unique<FunctionPointerType>(getType(FT->getReturnType())->toString() + "(*", getTypeDefName(), ")" + paramsToString);
-            sortedTypeDefs.push_back(static_cast<FunctionPointerType*>(typeDefs[type].get()));
-            return typeDefs[type].get();
+            auto* result = getFunctionPointerType(FT);
+            typeDefs[type] = static_cast<FunctionPointerType*>(result);
+            return result;
         }
 
-        auto* inner = getType(PT->getPointerElementType());
-        return makeCachedType<PointerType>(PT, inner);
+        // pointers to the same type share one object
+        return pointerTo(getType(PT->getPointerElementType()));
+    }
+
+    if (const auto* VT = llvm::dyn_cast<llvm::FixedVectorType>(type)) {
+        return vectorOf(getType(VT->getElementType()), VT->getNumElements());
     }
 
     if (type->isStructTy()) {
@@ -139,6 +102,31 @@ Type* TypeHandler::getType(const llvm::Type* type) {
     return nullptr;
 }
 
+Type* TypeHandler::getFunctionPointerType(const llvm::FunctionType* FT) {
+    std::vector<Type*> types;
+    types.reserve(FT->getNumParams() + 1);
+
+    // parameter types are resolved first, so typedefs they use are defined earlier
+    types.push_back(getType(FT->getReturnType()));
+    for (unsigned i = 0; i < FT->getNumParams(); i++) {
+        types.push_back(getType(FT->getParamType(i)));
+    }
+
+    auto key = std::make_pair(FT->isVarArg(), std::move(types));
+    auto it = signatures.find(key);
+    if (it != signatures.end()) {
+        return it->second.get();
+    }
+
+    std::vector<Type*> params(key.second.begin() + 1, key.second.end());
+    auto fpt = std::make_unique<FunctionPointerType>(getTypeDefName(), key.second[0], params, FT->isVarArg());
+    auto* result = fpt.get();
+    sortedTypeDefs.push_back(result);
+    signatures.emplace(std::move(key), std::move(fpt));
+
+    return result;
+}
+
 Type* TypeHandler::getBinaryType(Type* left, Type* right) {
     if (left != nullptr)
         return left;
@@ -179,6 +167,82 @@ Type* TypeHandler::pointerTo(Type* type) {
     return result;
 }
 
+VectorType* TypeHandler::vectorOf(Type* element, unsigned size) {
+    auto key = std::make_pair(element, size);
+    auto it = vectorTypes.find(key);
+    if (it != vectorTypes.end()) {
+        return it->second.get();
+    }
+
+    unsigned elementSize = 0;
+    switch (element->getKind()) {
+    case Type::TK_CharType: elementSize = 1; break;
+    case Type::TK_ShortType: elementSize = 2; break;
+    case Type::TK_IntType: elementSize = 4; break;
+    case Type::TK_LongType: elementSize = 8; break;
+    case Type::TK_FloatType: elementSize = 4; break;
+    case Type::TK_DoubleType: elementSize = 8; break;
+    default:
+        throw std::invalid_argument("Vectors of " + element->toString() + " are not supported!");
+    }
+
+    if (size == 0 || (size & (size - 1)) != 0) {
+        throw std::invalid_argument("Vectors with " + std::to_string(size) + " elements are not supported, the number of elements must be a power of two!");
+    }
+
+    auto vt = std::make_unique<VectorType>(getTypeDefName(), element, size, elementSize);
+    auto* result = vt.get();
+    sortedVectorTypes.push_back(result);
+    vectorTypes.emplace(key, std::move(vt));
+    return result;
+}
+
+IntegerType* TypeHandler::integerOfSize(unsigned bytes, bool isUnsigned) {
+    switch (bytes) {
+    case 1: return isUnsigned ? static_cast<IntegerType*>(uchar.get()) : schar.get();
+    case 2: return isUnsigned ? static_cast<IntegerType*>(ushort.get()) : sshort.get();
+    case 4: return isUnsigned ? static_cast<IntegerType*>(uint.get()) : sint.get();
+    case 8: return isUnsigned ? static_cast<IntegerType*>(ulong.get()) : slong.get();
+    default:
+        throw std::invalid_argument("No integer type has " + std::to_string(bytes) + " bytes!");
+    }
+}
+
+unsigned TypeHandler::naturalAlignment(const llvm::DataLayout& layout, llvm::Type* type) {
+    if (auto* VT = llvm::dyn_cast<llvm::VectorType>(type)) {
+        return naturalAlignment(layout, VT->getElementType());
+    }
+
+    if (auto* AT = llvm::dyn_cast<llvm::ArrayType>(type)) {
+        return naturalAlignment(layout, AT->getElementType());
+    }
+
+    if (auto* ST = llvm::dyn_cast<llvm::StructType>(type)) {
+        unsigned alignment = 1;
+        if (!ST->isOpaque()) {
+            for (auto* element : ST->elements()) {
+                alignment = std::max(alignment, naturalAlignment(layout, element));
+            }
+        }
+        return alignment;
+    }
+
+    if (!type->isSized()) {
+        return 1;
+    }
+
+    return layout.getABITypeAlign(type).value();
+}
+
+unsigned TypeHandler::variableAlignment(const llvm::DataLayout& layout, llvm::Type* type) {
+    unsigned alignment = naturalAlignment(layout, type);
+    if (type->isArrayTy() && layout.getTypeAllocSize(type) >= 16) {
+        alignment = std::max(alignment, 16u);
+    }
+
+    return alignment;
+}
+
 IntegerType* TypeHandler::toggleSignedness(IntegerType* ty) {
 
 #define TYPES(unsignedType,signedType) \
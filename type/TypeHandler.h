@@ -7,6 +7,7 @@
 #include "llvm/ADT/DenseMap.h"
 #include <llvm/IR/Module.h>
 
+#include <map>
 #include <memory>
 #include <vector>
 #include <unordered_map>
@@ -19,12 +20,18 @@ private:
     using uptr = std::unique_ptr<T>;
 
     Program* program;
-    llvm::DenseMap<const llvm::Type*, std::unique_ptr<Type>> typeDefs; //map containing typedefs
+    llvm::DenseMap<const llvm::Type*, FunctionPointerType*> typeDefs; //map containing typedefs of LLVM function pointer types
+
+    // key = (is variadic, return type followed by parameter types), value = typedef of function pointer with this signature
+    std::map<std::pair<bool, std::vector<Type*>>, uptr<FunctionPointerType>> signatures;
     std::unordered_map<const llvm::Type*, std::unique_ptr<Type>> typeCache;
 
     // key = T, value = Type representing pointer to T
     std::unordered_map<Type*, uptr<Type>> pointerTypes;
 
+    // key = (element type, number of elements), value = typedef of vector of the elements
+    std::map<std::pair<Type*, unsigned>, uptr<VectorType>> vectorTypes;
+
     unsigned typeDefCount = 0; //variable used for creating new name for typedef
 
     /**
@@ -37,16 +44,15 @@ private:
         return ret;
     }
 
-    template<typename T, typename ...Args>
-    Type* makeCachedType(const llvm::Type* ty, Args&&... args) {
-        auto ptr = std::make_unique<T>(std::forward<Args>(args)...);
-        auto* result = ptr.get();
-        typeCache[ty] = std::move(ptr);
-        return result;
-    }
+    /**
+     * @brief getFunctionPointerType Returns typedef of pointer to function of type @FT.
+     * Function pointer types with the same C signature share one typedef.
+     */
+    Type* getFunctionPointerType(const llvm::FunctionType* FT);
 
 public:
     std::vector<const FunctionPointerType*> sortedTypeDefs; //vector of sorted typedefs, used in output
+    std::vector<const VectorType*> sortedVectorTypes; //vector typedefs, written before the function pointer typedefs
 
     // basic C types
     uptr<IntType> uint = std::make_unique<IntType>(true);
@@ -99,13 +105,36 @@ public:
      * @return True if program has typedefs, false otherwise
      */
     bool hasTypeDefs() const {
-        return !typeDefs.empty();
+        return !typeDefs.empty() || !vectorTypes.empty();
     }
 
     IntegerType* toggleSignedness(IntegerType* ty);
 
     Type* pointerTo(Type* type);
 
+    /**
+     * @brief vectorOf Returns typedef of vector of @size elements of type @element.
+     * Only vectors of integers, float and double with power of two elements are supported.
+     */
+    VectorType* vectorOf(Type* element, unsigned size);
+
+    /**
+     * @brief integerOfSize Returns integer type with the given size in bytes.
+     */
+    IntegerType* integerOfSize(unsigned bytes, bool isUnsigned);
+
+    /**
+     * @brief naturalAlignment Returns alignment in bytes of the C type written for @type.
+     * Vectors are aligned only as their elements and structs are never packed in the output.
+     */
+    static unsigned naturalAlignment(const llvm::DataLayout& layout, llvm::Type* type);
+
+    /**
+     * @brief variableAlignment Returns alignment in bytes that the C compiler gives to a variable of type @type.
+     * The x86-64 ABI aligns array variables of at least 16 bytes to 16 bytes.
+     */
+    static unsigned variableAlignment(const llvm::DataLayout& layout, llvm::Type* type);
+
     IntegerType* setSigned(IntegerType* ty);
     IntegerType* setUnsigned(IntegerType* ty);
 };
@@ -2,6 +2,11 @@
 
 #include "../core/Block.h"
 
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
 void ExprWriter::indent() {
     for (size_t i = 0; i < indentCount; ++i) {
         ss << "    ";
@@ -92,17 +97,13 @@ void ExprWriter::visit(IfExpr& expr) {
     ss << "if (";
     expr.cmp->accept(*this);
     ss << ") {" << std::endl;
-    indentCount++;
-    indent();
-    expr.trueList->accept(*this);
-    indentCount--;
-    indent();
-    ss << "} else {" << std::endl;
-    indentCount++;
-    indent();
-    expr.falseList->accept(*this);
-    indentCount--;
+    writeBody(expr.trueList);
     indent();
+    if (expr.falseList) {
+        ss << "} else {" << std::endl;
+        writeBody(expr.falseList);
+        indent();
+    }
     ss << "}" << std::endl;
 }
 
@@ -380,8 +381,9 @@ void ExprWriter::visit(AshrExpr& expr) {
 }
 
 void ExprWriter::visit(LshrExpr& expr) {
-    auto IT = static_cast<IntegerType*>(expr.left->getType());
-    if (!IT->unsignedType) {
+    // vectors are always unsigned, see parseShiftInstruction
+    auto IT = llvm::dyn_cast_or_null<IntegerType>(expr.left->getType());
+    if (IT && !IT->unsignedType) {
         ss << "(unsigned " << IT->toString() << ")(";
     } else {
         ss << "(";
@@ -402,6 +404,7 @@ void ExprWriter::visit(StackAlloc& expr) {
     ss << expr.getType()->toString();
     ss << " ";
     ss << expr.getType()->surroundName(expr.value->valueName);
+    ss << alignmentAttribute(expr.value);
 }
 
 void ExprWriter::visit(ArrowExpr& expr) {
@@ -419,10 +422,44 @@ void ExprWriter::visit(ExprList& exprList) {
             indent();
         first = false;
         expr->accept(*this);
-        if (!llvm::isa<IfExpr>(expr) && !llvm::isa<SwitchExpr>(expr) && !llvm::isa<ExprList>(expr)) {
+        if (!isCompoundStatement(expr)) {
             ss << ";" << std::endl;
         }
     }
+
+    // label has to be followed by a statement
+    if (!exprList.expressions.empty() && llvm::isa<LabelExpr>(exprList.expressions.back())) {
+        indent();
+        ss << ";" << std::endl;
+    }
+}
+
+bool ExprWriter::isCompoundStatement(const Expr* expr) {
+    return llvm::isa<IfExpr>(expr) || llvm::isa<SwitchExpr>(expr) || llvm::isa<ExprList>(expr) ||
+           llvm::isa<WhileExpr>(expr) || llvm::isa<DoWhile>(expr) || llvm::isa<LabelExpr>(expr);
+}
+
+std::string ExprWriter::alignmentAttribute(const Value* var) {
+    if (var->alignment == 0) {
+        return "";
+    }
+
+    return " __attribute__((aligned(" + std::to_string(var->alignment) + ")))";
+}
+
+void ExprWriter::writeBody(Expr* body) {
+    auto* list = llvm::dyn_cast<ExprList>(body);
+    if (list && list->expressions.empty()) {
+        return;
+    }
+
+    indentCount++;
+    indent();
+    body->accept(*this);
+    if (!isCompoundStatement(body)) {
+        ss << ";" << std::endl;
+    }
+    indentCount--;
 }
 
 void ExprWriter::parensIfNotSimple(Expr* expr) {
@@ -438,14 +475,156 @@ void ExprWriter::parensIfNotSimple(Expr* expr) {
 }
 
 void ExprWriter::visit(AggregateInitializer& expr) {
+    // vector constants are used in expressions, so they are written as compound literals
+    if (llvm::isa_and_nonnull<VectorType>(expr.getType())) {
+        ss << "(" << expr.getType()->toString() << ")";
+    }
+
+    if (expr.values.empty()) {
+        auto AT = llvm::dyn_cast_or_null<ArrayType>(expr.getType());
+        auto ST = llvm::dyn_cast_or_null<AggregateType>(expr.getType());
+        if ((AT && AT->size == 0) || (ST && ST->items.empty())) {
+            ss << "{}";
+        } else {
+            ss << "{0}";
+        }
+        return;
+    }
+
+    const auto ST = llvm::dyn_cast_or_null<AggregateType>(expr.getType());
+
     ss << "{";
-    for (auto& val : expr.values) {
-        val->accept(*this);
+    for (size_t i = 0; i < expr.values.size(); ++i) {
+        if (!expr.indices.empty()) {
+            if (ST) {
+                ss << "." << ST->items[expr.indices[i]].second << " = ";
+            } else {
+                ss << "[" << expr.indices[i] << "] = ";
+            }
+        }
+
+        expr.values[i]->accept(*this);
         ss << ",";
     }
     ss << "}";
 }
 
+/**
+ * @brief writeStringLiteral Writes @data as an escaped C string literal.
+ * The literal is built in a buffer that is flushed in large chunks.
+ */
+static void writeStringLiteral(std::ostream& ss, const std::string& data) {
+    static const char* digits = "01234567";
+
+    // the size of the array is always written, so the trailing zeros are implicit
+    size_t size = data.size();
+    while (size > 0 && data[size - 1] == '\0') {
+        --size;
+    }
+
+    std::string buffer;
+    buffer.reserve(std::min<size_t>(size + 2, 1 << 16) + 4);
+    buffer += '"';
+
+    for (size_t i = 0; i < size; ++i) {
+        unsigned char c = data[i];
+
+        switch (c) {
+        case '\n': buffer += "\\n"; break;
+        case '\t': buffer += "\\t"; break;
+        case '\r': buffer += "\\r"; break;
+        case '"': buffer += "\\\""; break;
+        case '\\': buffer += "\\\\"; break;
+        case '?':
+            // avoid trigraphs
+            if (i > 0 && data[i - 1] == '?') {
+                buffer += "\\?";
+            } else {
+                buffer += '?';
+            }
+            break;
+        default:
+            if (c >= 0x20 && c < 0x7f) {
+                buffer += c;
+            } else {
+                // always use three digits, so the following character cannot become a part of the escape sequence
+                buffer += '\\';
+                buffer += digits[c >> 6];
+                buffer += digits[(c >> 3) & 7];
+                buffer += digits[c & 7];
+            }
+        }
+
+        if (buffer.size() >= (1 << 16)) {
+            ss.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    }
+
+    buffer += '"';
+    ss.write(buffer.data(), buffer.size());
+}
+
+void ExprWriter::visit(DataInitializer& expr) {
+    if (llvm::isa_and_nonnull<VectorType>(expr.getType())) {
+        ss << "(" << expr.getType()->toString() << ")";
+    } else if (expr.elementSize == 1 && !expr.designated) {
+        writeStringLiteral(ss, expr.data);
+        return;
+    }
+
+    const char* raw = expr.data.data();
+    char number[32];
+    std::string buffer;
+
+    ss << "{";
+    for (size_t i = 0; i < expr.getNumElements(); ++i) {
+        const char* elem = raw + i * expr.elementSize;
+
+        if (expr.designated) {
+            if (std::all_of(elem, elem + expr.elementSize, [](char c) { return c == 0; })) {
+                continue;
+            }
+            buffer += "[" + std::to_string(i) + "] = ";
+        }
+
+        int len = 0;
+        if (expr.isFloatingPoint && expr.elementSize == sizeof(float)) {
+            float value;
+            std::memcpy(&value, elem, sizeof(value));
+            len = snprintf(number, sizeof(number), "%.9g", value);
+        } else if (expr.isFloatingPoint) {
+            double value;
+            std::memcpy(&value, elem, sizeof(value));
+            len = snprintf(number, sizeof(number), "%.17g", value);
+        } else {
+            int64_t value = 0;
+            switch (expr.elementSize) {
+            case 1: { int8_t v; std::memcpy(&v, elem, 1); value = v; break; }
+            case 2: { int16_t v; std::memcpy(&v, elem, 2); value = v; break; }
+            case 4: { int32_t v; std::memcpy(&v, elem, 4); value = v; break; }
+            default: std::memcpy(&value, elem, sizeof(value)); break;
+            }
+            len = snprintf(number, sizeof(number), "%" PRId64, value);
+        }
+
+        buffer.append(number, len);
+        // keep floating point literals distinguishable from integers (e.g. -0.0)
+        if (expr.isFloatingPoint && std::strpbrk(number, ".en") == nullptr) {
+            buffer += ".0";
+        }
+        buffer += ",";
+
+        if (buffer.size() >= (1 << 16)) {
+            ss.write(buffer.data(), buffer.size());
+            buffer.clear();
+        }
+    }
+
+    ss.write(buffer.data(), buffer.size());
+    ss << "}";
+}
+
 void ExprWriter::visit(LogicalAnd& expr) {
     parensIfNotSimple(expr.lhs);
     ss << " && ";
@@ -470,8 +649,34 @@ void ExprWriter::visit(LogicalNot& expr) {
 
 void ExprWriter::visit(DoWhile& expr) {
     ss << "do {" << std::endl;
-    expr.body->accept(*this);
+    writeBody(expr.body);
+    indent();
     ss << "} while (";
     expr.cond->accept(*this);
     ss << ");" << std::endl;
 }
+
+void ExprWriter::visit(WhileExpr& expr) {
+    ss << "while (";
+    if (expr.cond) {
+        expr.cond->accept(*this);
+    } else {
+        ss << "1";
+    }
+    ss << ") {" << std::endl;
+    writeBody(expr.body);
+    indent();
+    ss << "}" << std::endl;
+}
+
+void ExprWriter::visit(BreakExpr& expr) {
+    ss << "break";
+}
+
+void ExprWriter::visit(ContinueExpr& expr) {
+    ss << "continue";
+}
+
+void ExprWriter::visit(LabelExpr& expr) {
+    ss << expr.block->blockName << ":" << std::endl;
+}
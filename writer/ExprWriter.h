@@ -19,11 +19,26 @@ private:
     void parensIfNotSimple(Expr* expr);
     void indent();
 
+    /**
+     * @brief writeBody Writes body of a statement one level deeper, the caller writes the closing brace.
+     */
+    void writeBody(Expr* body);
+
 public:
     ExprWriter(std::ostream& os, bool noFuncCasts, bool forceBlockLabels);
 
     void gotoOrInline(Block* block, bool doIndent);
 
+    /**
+     * @brief isCompoundStatement Returns true if the expression is written as a statement ending with newline, without semicolon.
+     */
+    static bool isCompoundStatement(const Expr* expr);
+
+    /**
+     * @brief alignmentAttribute Returns the attribute aligning the variable, empty string if the variable is aligned naturally.
+     */
+    static std::string alignmentAttribute(const Value* var);
+
     void visit(AggregateElement& expr) override;
     void visit(ArrayElement& expr) override;
     void visit(ExtractValueExpr& expr) override;
@@ -56,6 +71,7 @@ public:
     void visit(StackAlloc& expr) override;
     void visit(ArrowExpr& expr) override;
     void visit(AggregateInitializer& ai) override;
+    void visit(DataInitializer& expr) override;
     void visit(LogicalAnd& expr) override;
     void visit(LogicalOr& expr) override;
     void visit(GotoExpr& expr) override;
@@ -63,6 +79,10 @@ public:
     void visit(MinusExpr& expr) override;
     void visit(LogicalNot& expr) override;
     void visit(DoWhile& expr) override;
+    void visit(WhileExpr& expr) override;
+    void visit(BreakExpr& expr) override;
+    void visit(ContinueExpr& expr) override;
+    void visit(LabelExpr& expr) override;
 
     virtual ~ExprWriter() = default;
 };
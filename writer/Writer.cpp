@@ -1,6 +1,12 @@
 #include "Writer.h"
 #include "../parser/cfunc.h"
 
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/TimeProfiler.h>
+
+#include <algorithm>
+#include <fstream>
 #include <unordered_set>
 
 #define SECTION_START(name, cond)\
@@ -14,16 +20,22 @@
         wr.line("");\
     }
 
+#define WRITE_SECTION(section)\
+    do {\
+        llvm::TimeTraceScope sectionScope("Writer", #section);\
+        section(program);\
+    } while (0)
+
 void Writer::writeProgram(const Program& program) {
-    includes(program);
-    structDeclarations(program);
-    anonymousStructDeclarations(program);
-    typedefs(program);
-    structDefinitions(program);
-    unionDefinitions(program);
-    functionDeclarations(program);
-    globalVarDefinitions(program);
-    functionDefinitions(program);
+    WRITE_SECTION(includes);
+    WRITE_SECTION(structDeclarations);
+    WRITE_SECTION(anonymousStructDeclarations);
+    WRITE_SECTION(typedefs);
+    WRITE_SECTION(structDefinitions);
+    WRITE_SECTION(unionDefinitions);
+    WRITE_SECTION(functionDeclarations);
+    WRITE_SECTION(globalVarDefinitions);
+    WRITE_SECTION(functionDefinitions);
 }
 
 void Writer::includes(const Program& program) {
@@ -115,9 +127,8 @@ void Writer::structDefinitions(const Program& program) {
         structDefinition(program, strct.get(), printed);
     }
 
-    for (const auto& pair : program.unnamedStructs) {
-        const auto& strct = pair.second;
-        structDefinition(program, strct.get(), printed);
+    for (const auto* strct : program.sortedUnnamedStructs) {
+        structDefinition(program, strct, printed);
     }
 
     SECTION_END;
@@ -149,11 +160,15 @@ void Writer::unionDefinitions(const Program& program) {
 
 
 void Writer::typedefs(const Program& program) {
-    SECTION_START("type definitions", !program.typeHandler.sortedTypeDefs.empty());
+    SECTION_START("type definitions", !program.typeHandler.sortedTypeDefs.empty() || !program.typeHandler.sortedVectorTypes.empty());
+    for (const auto* vector : program.typeHandler.sortedVectorTypes) {
+        wr.defineType(vector->elementType->toString(), vector->name, vector->attributesToString());
+    }
+
     const auto& defs = program.typeHandler.sortedTypeDefs;
 
     for (const auto& def : defs) {
-        wr.defineType(def->type, def->name, def->typeEnd);
+        wr.defineType(def->typeToString(), def->name, def->typeEndToString());
     }
 
     SECTION_END;
@@ -161,10 +176,8 @@ void Writer::typedefs(const Program& program) {
 
 void Writer::anonymousStructDeclarations(const Program& program) {
     SECTION_START("anonymous struct declarations", !program.unnamedStructs.empty());
-    const auto& structs = program.unnamedStructs;
-
-    for (const auto& elem : structs) {
-        wr.declareStruct(elem.second->name);
+    for (const auto* strct : program.sortedUnnamedStructs) {
+        wr.declareStruct(strct->name);
     }
 
     SECTION_END;
@@ -177,7 +190,7 @@ void Writer::globalVars(const Program& program) {
             continue;
         }
 
-        wr.declareVar(gvar->getType()->toString(), gvar->getType()->surroundName(gvar->valueName));
+        wr.declareVar(gvar->getType()->toString(), gvar->getType()->surroundName(gvar->valueName) + ExprWriter::alignmentAttribute(gvar.get()));
     }
 
     SECTION_END;
@@ -190,6 +203,10 @@ void Writer::globalVarDefinitions(const Program& program) {
             continue;
         }
 
+        if (globalVarBlob(gvar.get())) {
+            continue;
+        }
+
         if (gvar->isStatic) {
             wr.raw("static ");
         }
@@ -197,6 +214,7 @@ void Writer::globalVarDefinitions(const Program& program) {
         wr.raw(gvar->getType()->toString());
         wr.raw(" ");
         wr.raw(gvar->getType()->surroundName(gvar->valueName));
+        wr.raw(ExprWriter::alignmentAttribute(gvar.get()));
 
         if (gvar->value) {
             wr.raw(" = ");
@@ -209,6 +227,67 @@ void Writer::globalVarDefinitions(const Program& program) {
     SECTION_END;
 }
 
+/**
+ * Writes raw data of a large initializer into a side file next to the output and defines the variable
+ * using either C23 #embed (byte arrays only) or .incbin directive of the assembler.
+ * #embed refers to the side file relative to the output, as quoted includes are found next to the including file,
+ * while .incbin gets the absolute path, because the assembler searches only its working directory.
+ */
+bool Writer::globalVarBlob(GlobalValue* gvar) {
+    const auto* init = llvm::dyn_cast_or_null<DataInitializer>(gvar->value);
+    if (blobThreshold == 0 || !init || init->data.size() < blobThreshold) {
+        return false;
+    }
+
+    std::string path = blobPrefix + "." + gvar->valueName + ".bin";
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::invalid_argument("Blob file " + path + " cannot be opened!");
+    }
+    file.write(init->data.data(), init->data.size());
+
+    std::string fileName = path.substr(path.find_last_of('/') + 1);
+    llvm::SmallString<256> absolutePath(path);
+    llvm::sys::fs::make_absolute(absolutePath);
+    // the ABI alignment of arrays with at least 16 bytes, the compiler may rely on it also for the extern declaration
+    unsigned alignment = gvar->alignment ? gvar->alignment : std::max<unsigned>(init->elementSize, init->data.size() >= 16 ? 16 : 1);
+
+    if (blobEmbed && init->elementSize == 1) {
+        if (gvar->isStatic) {
+            wr.raw("static ");
+        }
+
+        wr.raw(gvar->getType()->toString());
+        wr.raw(" ");
+        wr.raw(gvar->getType()->surroundName(gvar->valueName));
+        wr.raw(" __attribute__((aligned(" + std::to_string(alignment) + ")))");
+        wr.line(" = {");
+        wr.line("#embed \"" + fileName + "\"");
+        wr.line("};");
+        return true;
+    }
+
+    // the symbol is defined in assembly, C code only refers to it
+    wr.raw("extern ");
+    wr.raw(gvar->getType()->toString());
+    wr.raw(" ");
+    wr.raw(gvar->getType()->surroundName(gvar->valueName));
+    wr.line(";");
+
+    wr.line(std::string("__asm__(\".section ") + (gvar->isConstant ? ".rodata" : ".data") + "\\n\"");
+    if (!gvar->isStatic) {
+        wr.line("    \".globl " + gvar->valueName + "\\n\"");
+    }
+    wr.line("    \".type " + gvar->valueName + ", @object\\n\"");
+    wr.line("    \".balign " + std::to_string(alignment) + "\\n\"");
+    wr.line("    \"" + gvar->valueName + ":\\n\"");
+    wr.line("    \".incbin \\\"" + absolutePath.str().str() + "\\\"\\n\"");
+    wr.line("    \".size " + gvar->valueName + ", " + std::to_string(init->data.size()) + "\\n\"");
+    wr.line("    \".previous\");");
+
+    return true;
+}
+
 void Writer::functionHead(const Func* func) {
     if (func->isDeclaration)
         wr.raw("extern ");
@@ -227,6 +306,8 @@ void Writer::functionHead(const Func* func) {
         const auto& param = *it;
         wr.raw(param->getType()->toString());
         wr.raw(" ");
+        if (func->restrictParameters.count(param))
+            wr.raw("restrict ");
         param->accept(ew);
 
         if (it != last)
@@ -273,7 +354,7 @@ void Writer::functionDeclarations(const Program& program) {
 }
 
 bool Writer::isFunctionPrinted(const Func* func) const {
-    if (isCFunc(func->name) || func->name == "va_start" || func->name == "va_end" || func->name == "va_copy" || isCMath(func->name)) {
+    if (isCFunc(func->name) || isBuiltin(func->name) || func->name == "va_start" || func->name == "va_end" || func->name == "va_copy" || isCMath(func->name)) {
         return false;
     }
 
@@ -297,7 +378,7 @@ void Writer::writeBlock(const Block* block) {
     for (const auto& expr : block->expressions) {
         wr.indent(1);
         expr->accept(ew);
-        if (!llvm::isa<IfExpr>(expr) && !llvm::isa<SwitchExpr>(expr) && !llvm::isa<ExprList>(expr)) {
+        if (!ExprWriter::isCompoundStatement(expr)) {
             wr.line(";");
         }
     }
@@ -322,6 +403,7 @@ void Writer::functionDefinitions(const Program& program) {
     std::sort(functions.begin(), functions.end(), [](const Func* a, const Func* b){ return a->name <= b->name;});
 
     for (const auto* func : functions) {
+        llvm::TimeTraceScope functionScope("Function", func->name);
 
         functionHead(func);
         wr.startFunctionBody();
@@ -329,7 +411,7 @@ void Writer::functionDefinitions(const Program& program) {
         // start with variables
         for (const auto& var : func->variables) {
             wr.indent(1);
-            wr.declareVar(var->getType()->toString(), var->getType()->surroundName(var->valueName));
+            wr.declareVar(var->getType()->toString(), var->getType()->surroundName(var->valueName) + ExprWriter::alignmentAttribute(var));
         }
 
         assert(func->entry);
@@ -20,6 +20,10 @@ private:
     bool noFuncCasts;
     bool forceBlockLabels;
 
+    size_t blobThreshold; // initializers with at least this many bytes are written to side files, 0 disables side files
+    std::string blobPrefix; // path prefix of the side files
+    bool blobEmbed; // side files are included using #embed instead of .incbin
+
     void includes(const Program& program);
     void unionDeclarations(const Program& program);
     void structDeclarations(const Program& program);
@@ -37,9 +41,10 @@ private:
     void writeBlock(const Block* block);
     void unionDefinition(const Program& program, const UnionType* unn);
     void unionDefinitions(const Program& program);
+    bool globalVarBlob(GlobalValue* gvar);
 
 
 public:
-    Writer(std::ostream& stream, bool useIncludes, bool noFuncCasts, bool forceBlockLabels) : wr(CWriter(stream)), ew(ExprWriter(stream, noFuncCasts, forceBlockLabels)), useIncludes(useIncludes), noFuncCasts(true), forceBlockLabels(forceBlockLabels) {}
+    Writer(std::ostream& stream, bool useIncludes, bool noFuncCasts, bool forceBlockLabels, size_t blobThreshold = 0, const std::string& blobPrefix = "", bool blobEmbed = false) : wr(CWriter(stream)), ew(ExprWriter(stream, noFuncCasts, forceBlockLabels)), useIncludes(useIncludes), noFuncCasts(true), forceBlockLabels(forceBlockLabels), blobThreshold(blobThreshold), blobPrefix(blobPrefix), blobEmbed(blobEmbed) {}
     void writeProgram(const Program& program);
 };